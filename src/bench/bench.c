@@ -0,0 +1,99 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "bench/bench.h"
+
+static s_bench const	benchmarks[] =
+{
+	{ "loader",    bench_loader },
+	{ "idle",      bench_idle },
+	{ "sprites",   bench_sprites },
+	{ "ring",      bench_ring },
+	{ "state",     bench_state },
+	{ "instances", bench_instances },
+	{ "indirect",  bench_indirect },
+	{ "uniforms",  bench_uniforms },
+	{ "shaders",   bench_shaders },
+	{ "uploads",   bench_uploads },
+	{ "textures",  bench_textures },
+	{ "readback",  bench_readback },
+	{ "softraster", bench_softraster },
+	{ "jobs",      bench_jobs },
+	{ "commands",  bench_commands },
+	{ "ecs",       bench_ecs },
+};
+#define BENCHMARKS	(sizeof(benchmarks) / sizeof(benchmarks[0]))
+
+int	bench_run(s_config const* config)
+{
+	int all = (strcmp(config->bench, "all") == 0);
+	int found = 0;
+	int status = 0;
+	size_t i;
+
+	for (i = 0; i < BENCHMARKS; ++i)
+	{
+		if (all || strcmp(config->bench, benchmarks[i].name) == 0)
+		{
+			found = 1;
+			printf("=== bench: %s ===\n", benchmarks[i].name);
+			if (benchmarks[i].run(config))
+			{
+				fprintf(stderr, "error: benchmark '%s' failed\n", benchmarks[i].name);
+				status = -1;
+			}
+			fflush(stdout);
+		}
+	}
+	if (!found)
+	{
+		fprintf(stderr, "error: unknown benchmark '%s', expected one of: all", config->bench);
+		for (i = 0; i < BENCHMARKS; ++i)
+			fprintf(stderr, ", %s", benchmarks[i].name);
+		fprintf(stderr, "\n");
+		return -1;
+	}
+	return status;
+}
+
+double	bench_time(void)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart * 1000. / (double)frequency.QuadPart;
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec * 1000. + (double)now.tv_nsec / 1000000.;
+#endif
+}
+
+static int	compare_double(void const* a, void const* b)
+{
+	double x = *(double const*)a;
+	double y = *(double const*)b;
+	return (x > y) - (x < y);
+}
+
+void	bench_report(char const* label, double* samples, int count)
+{
+	if (count <= 0)
+		return;
+	qsort(samples, (size_t)count, sizeof(double), compare_double);
+	printf("%-32s min %9.3f ms | median %9.3f ms | max %9.3f ms  (n=%d)\n", label,
+		samples[0],
+		samples[count / 2],
+		samples[count - 1],
+		count);
+}
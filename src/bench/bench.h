@@ -0,0 +1,48 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "config.h"
+
+//! A benchmark which can be selected on the command-line, with `--bench <name>`
+typedef struct bench
+{
+	char const*	name;	//!< The name given on the command-line to select this benchmark
+	int		(*run)(s_config const* config);	//!< Runs the benchmark and prints its results, returns `0` on success
+}	s_bench;
+
+//! Runs the benchmark named by `config->bench` (or every benchmark if that name is "all")
+/*!
+**	@returns
+**	`0` if every benchmark which was run succeeded, nonzero otherwise
+*/
+int	bench_run(s_config const* config);
+
+//! Returns the value of a monotonic clock, in milliseconds
+double	bench_time(void);
+
+//! Prints the minimum/median/maximum of the given samples (in milliseconds), on one line
+/*!
+**	@param label	The name printed at the start of the line
+**	@param samples	The measured timings - this array gets sorted in-place
+**	@param count	The amount of items in `samples`
+*/
+void	bench_report(char const* label, double* samples, int count);
+
+int	bench_loader(s_config const* config);
+int	bench_idle(s_config const* config);
+int	bench_sprites(s_config const* config);
+int	bench_ring(s_config const* config);
+int	bench_state(s_config const* config);
+int	bench_instances(s_config const* config);
+int	bench_indirect(s_config const* config);
+int	bench_uniforms(s_config const* config);
+int	bench_shaders(s_config const* config);
+int	bench_uploads(s_config const* config);
+int	bench_textures(s_config const* config);
+int	bench_readback(s_config const* config);
+int	bench_softraster(s_config const* config);
+int	bench_jobs(s_config const* config);
+int	bench_commands(s_config const* config);
+int	bench_ecs(s_config const* config);
+
+#endif
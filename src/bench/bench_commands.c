@@ -0,0 +1,303 @@
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "gl_util.h"
+#include "command_buffer.h"
+#include "jobs.h"
+#include "mat4.h"
+#include "bench/bench.h"
+
+#define COMMANDS_FRAMES		20
+#define COMMANDS_OBJECTS	10000
+#define COMMANDS_SIZE		256
+//! The command buffers which the objects are recorded into, whatever the amount of threads
+#define COMMANDS_BUFFERS	32
+//! The bytes of commands which each object records, at most
+#define COMMANDS_PER_OBJECT	160
+
+static char const* const	vertex_shader =
+	"#version 330 core\n"
+	"uniform mat4 u_transform;\n"
+	"uniform vec4 u_color;\n"
+	"out vec4 v_color;\n"
+	"void main()\n"
+	"{\n"
+	"	vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1) - 0.5;\n"
+	"	gl_Position = u_transform * vec4(corner, 0., 1.);\n"
+	"	v_color = u_color;\n"
+	"}\n";
+
+static char const* const	fragment_shader =
+	"#version 330 core\n"
+	"in vec4 v_color;\n"
+	"out vec4 f_color;\n"
+	"void main()\n"
+	"{\n"
+	"	f_color = v_color;\n"
+	"}\n";
+
+//! What the draws of a frame need
+typedef struct commands_scene
+{
+	GLuint				program;
+	GLuint				vertex_array;
+	GLint				transform_location;
+	GLint				color_location;
+	s_mat4				view_projection;
+	s_command_buffer	buffers[COMMANDS_BUFFERS];
+}	s_commands_scene;
+
+//! The objects which a job records, into its own command buffer
+typedef struct commands_part
+{
+	s_commands_scene const*	scene;
+	s_command_buffer*		buffer;
+}	s_commands_part;
+
+//! Works out the transform and color of an object: the CPU side of building its draw
+static void	prepare(s_commands_scene const* scene, int i, s_mat4* transform, float color[4])
+{
+	s_mat4 model;
+	float angle = (float)i * 0.37f;
+	float c = cosf(angle) * 0.1f;
+	float s = sinf(angle) * 0.1f;
+
+	mat4_identity(&model);
+	model.m[0] = c;
+	model.m[1] = s;
+	model.m[4] = -s;
+	model.m[5] = c;
+	model.m[12] = (float)(i % 100) * 0.02f - 1.f;
+	model.m[13] = (float)(i / 100) * 0.02f - 1.f;
+	model.m[14] = (float)(i % 7) * -0.1f;
+	mat4_multiply(transform, &scene->view_projection, &model);
+	color[0] = (float)(i % 256) / 255.f;
+	color[1] = (float)(i / 256 % 256) / 255.f;
+	color[2] = 0.5f;
+	color[3] = 1.f;
+}
+
+//! Builds and makes the draws of the objects, on the thread which has the context
+static void	draw_direct(s_commands_scene const* scene)
+{
+	s_mat4 transform;
+	float color[4];
+	int i;
+
+	for (i = 0; i < COMMANDS_OBJECTS; ++i)
+	{
+		prepare(scene, i, &transform, color);
+		gl_state_use_program(scene->program);
+		gl_state_bind_vertex_array(scene->vertex_array);
+		gl_state_enable(GL_DEPTH_TEST, 0);
+		gl_state_enable(GL_BLEND, 0);
+		glUniformMatrix4fv(scene->transform_location, 1, GL_FALSE, transform.m);
+		glUniform4fv(scene->color_location, 1, color);
+		glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	}
+}
+
+//! Records the draws of the objects from `begin` to `end`, into the command buffer of their part
+static void	record(void* data, size_t begin, size_t end)
+{
+	s_commands_scene const* scene = ((s_commands_part*)data)->scene;
+	s_command_buffer* buffer = ((s_commands_part*)data)->buffer;
+	s_mat4 transform;
+	float color[4];
+	size_t i;
+
+	command_buffer_reset(buffer);
+	for (i = begin; i < end; ++i)
+	{
+		prepare(scene, (int)i, &transform, color);
+		command_use_program(buffer, scene->program);
+		command_bind_vertex_array(buffer, scene->vertex_array);
+		command_enable(buffer, GL_DEPTH_TEST, 0);
+		command_enable(buffer, GL_BLEND, 0);
+		command_uniform_matrix4(buffer, scene->transform_location, transform.m);
+		command_uniform_4f(buffer, scene->color_location, color);
+		command_draw_arrays(buffer, GL_TRIANGLE_STRIP, 0, 4);
+	}
+}
+
+//! Draws frames, directly (if `jobs` is `NULL`) or recorded by jobs then replayed, and reads the last one back
+static int	run(s_window* window, s_commands_scene* scene, s_jobs* jobs, uint8_t* pixels)
+{
+	static double samples[3][COMMANDS_FRAMES];
+	s_commands_part parts[COMMANDS_BUFFERS];
+	s_job list[COMMANDS_BUFFERS];
+	s_job_counter counter;
+	char label[64];
+	double start, recorded, submitted;
+	int status = 0;
+	int frame, i;
+
+	for (i = 0; i < COMMANDS_BUFFERS; ++i)
+	{
+		parts[i].scene = scene;
+		parts[i].buffer = &scene->buffers[i];
+		list[i].run = record;
+		list[i].data = &parts[i];
+		list[i].begin = (size_t)i * COMMANDS_OBJECTS / COMMANDS_BUFFERS;
+		list[i].end = (size_t)(i + 1) * COMMANDS_OBJECTS / COMMANDS_BUFFERS;
+	}
+	/* one more frame than measured, to warm up the driver */
+	for (frame = -1; frame < COMMANDS_FRAMES; ++frame)
+	{
+		start = bench_time();
+		glClear(GL_COLOR_BUFFER_BIT);
+		recorded = start;
+		if (!jobs)
+			draw_direct(scene);
+		else
+		{
+			atomic_init(&counter.pending, 0);
+			jobs_run(jobs, list, COMMANDS_BUFFERS, &counter);
+			jobs_wait(jobs, &counter);
+			recorded = bench_time();
+			if (command_buffer_replay(scene->buffers, COMMANDS_BUFFERS))
+				status = -1;
+		}
+		submitted = bench_time();
+		if (frame == COMMANDS_FRAMES - 1)
+		{
+			gl_state_bind_framebuffer(GL_READ_FRAMEBUFFER, window_framebuffer(window));
+			glReadPixels(0, 0, COMMANDS_SIZE, COMMANDS_SIZE, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+		}
+		window_swap_buffers(window);
+		glFinish();
+		if (frame >= 0)
+		{
+			samples[0][frame] = recorded - start;
+			samples[1][frame] = submitted - recorded;
+			samples[2][frame] = bench_time() - start;
+		}
+	}
+	if (!jobs)
+	{
+		bench_report("direct: build + submit (CPU)", samples[1], COMMANDS_FRAMES);
+		bench_report("direct: frame", samples[2], COMMANDS_FRAMES);
+		return status;
+	}
+	snprintf(label, sizeof(label), "%d thread%s%s: record", jobs->thread_count, (jobs->thread_count > 1 ? "s" : ""),
+		(jobs->thread_count > jobs_cpu_count() ? " (more than CPUs)" : ""));
+	bench_report(label, samples[0], COMMANDS_FRAMES);
+	bench_report("  replay (CPU)", samples[1], COMMANDS_FRAMES);
+	bench_report("  frame", samples[2], COMMANDS_FRAMES);
+	return status;
+}
+
+//! Draws with the objects built directly, then recorded on 1 thread and up to twice as many as there are CPUs
+static int	run_all(s_window* window, s_commands_scene* scene)
+{
+	static s_jobs jobs;
+	uint8_t* expected;
+	uint8_t* pixels;
+	size_t words = 0;
+	int threads;
+	int status;
+	int i;
+
+	expected = (uint8_t*)malloc(COMMANDS_SIZE * COMMANDS_SIZE * 4);
+	pixels = (uint8_t*)malloc(COMMANDS_SIZE * COMMANDS_SIZE * 4);
+	if (!expected || !pixels)
+	{
+		free(expected);
+		free(pixels);
+		return -1;
+	}
+	status = run(window, scene, NULL, expected);
+	for (threads = 1; status == 0 && threads <= 2 * jobs_cpu_count() && threads <= JOBS_MAX_THREADS; threads *= 2)
+	{
+		if (jobs_init(&jobs, threads))
+		{
+			status = -1;
+			break;
+		}
+		gl_state.calls = 0;
+		gl_state.filtered = 0;
+		status = run(window, scene, &jobs, pixels);
+		jobs_free(&jobs);
+		if (status == 0 && memcmp(pixels, expected, COMMANDS_SIZE * COMMANDS_SIZE * 4))
+		{
+			fprintf(stderr, "error: the replayed frame differs from the direct one\n");
+			status = -1;
+		}
+	}
+	if (status == 0)
+	{
+		for (i = 0; i < COMMANDS_BUFFERS; ++i)
+			words += scene->buffers[i].count;
+		printf("%-32s %zu bytes of commands/frame, %ld state changes/frame (%ld redundant ones dropped)\n", "",
+			words * sizeof(uint32_t), gl_state.calls / (COMMANDS_FRAMES + 1), gl_state.filtered / (COMMANDS_FRAMES + 1));
+	}
+	free(expected);
+	free(pixels);
+	return status;
+}
+
+int	bench_commands(s_config const* config)
+{
+	static s_commands_scene scene;
+	static float const	eye[3] = { 0.f, 0.f, 3.f };
+	static float const	target[3] = { 0.f, 0.f, 0.f };
+	static float const	up[3] = { 0.f, 1.f, 0.f };
+	s_window* window;
+	s_mat4 view;
+	int status = -1;
+	int i;
+
+	(void)config;
+	if (window_init())
+		return -1;
+	window = window_create(COMMANDS_SIZE, COMMANDS_SIZE, "bench: commands", 0);
+	if (!window)
+	{
+		window_terminate();
+		return -1;
+	}
+	window_make_current(window);
+	if (window_load_gl(window, 0))
+	{
+		gl_caps_init();
+		gl_state_init();
+		printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+		printf("%d objects, each with its own transform and color, in %d command buffers\n",
+			COMMANDS_OBJECTS, COMMANDS_BUFFERS);
+		scene.program = gl_create_program(vertex_shader, fragment_shader);
+		for (i = 0; i < COMMANDS_BUFFERS; ++i)
+		{
+			if (command_buffer_init(&scene.buffers[i],
+				(COMMANDS_OBJECTS / COMMANDS_BUFFERS + 1) * COMMANDS_PER_OBJECT))
+				break;
+		}
+		if (scene.program && i == COMMANDS_BUFFERS)
+		{
+			scene.transform_location = glGetUniformLocation(scene.program, "u_transform");
+			scene.color_location = glGetUniformLocation(scene.program, "u_color");
+			mat4_perspective(&scene.view_projection, 1.2f, 1.f, 0.1f, 10.f);
+			mat4_look_at(&view, eye, target, up);
+			mat4_multiply(&scene.view_projection, &scene.view_projection, &view);
+			glGenVertexArrays(1, &scene.vertex_array);
+			glViewport(0, 0, COMMANDS_SIZE, COMMANDS_SIZE);
+			status = run_all(window, &scene);
+			gl_state_delete_vertex_arrays(1, &scene.vertex_array);
+		}
+		while (i > 0)
+			command_buffer_free(&scene.buffers[--i]);
+		if (scene.program)
+			glDeleteProgram(scene.program);
+	}
+	window_destroy(window);
+	gladUnloadGL();
+	window_terminate();
+	return status;
+}
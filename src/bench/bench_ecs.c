@@ -0,0 +1,389 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ecs.h"
+#include "jobs.h"
+#include "meshes.h"
+#include "bench/bench.h"
+
+#define ECS_RUNS		10
+//! The entities iterated over and updated
+#define ECS_ENTITIES	1000000
+//! The time step of an update, in seconds
+#define ECS_DT			(1.f / 60.f)
+//! The least chunks which a job updates
+#define ECS_GRAIN		4
+//! The radius of the bounding sphere of a unit cube, per unit of scale
+#define ECS_RADIUS		0.866f
+
+/*
+**	The same entities, stored the way a scene graph commonly does: an object
+**	per entity, each allocated on its own, and reached through an array of
+**	pointers (shuffled, as objects come and go over a scene's life).
+*/
+typedef struct object
+{
+	s_ecs_transform	transform;
+	float			spin;
+	s_ecs_bounds	bounds;
+	s_ecs_color		color;
+	int				shape;		//!< The mesh, or `-1` if it is not drawn
+	int				spins;		//!< Nonzero if `spin` is set
+}	s_object;
+
+//! The components of the entity `i`: it always has a transform, a mesh (but 1 in 6), and a spin (1 in 2)
+static uint32_t	entity_mask(size_t i)
+{
+	uint32_t mask = ECS_BIT(ECS_TRANSFORM) | ECS_BIT(ECS_BOUNDS) | ECS_BIT(ECS_COLOR);
+
+	if (i % 6 == 5)
+		return mask;
+	mask |= ECS_BIT(ECS_MESH + i % ENUMLENGTH_MESH_SHAPE);
+	if (i % 2 == 0)
+		mask |= ECS_BIT(ECS_SPIN);
+	return mask;
+}
+
+static void	entity_init(size_t i, s_ecs_transform* transform, s_ecs_color* color)
+{
+	transform->position[0] = (float)(i % 100) * 1.5f;
+	transform->position[1] = (float)(i / 10000) * 1.5f;
+	transform->position[2] = (float)(i / 100 % 100) * 1.5f;
+	transform->scale = 0.5f + (float)(i % 7) * 0.1f;
+	transform->angle = (float)(i % 360) * 0.01f;
+	color->rgba[0] = (uint8_t)i;
+	color->rgba[1] = (uint8_t)(i >> 8);
+	color->rgba[2] = (uint8_t)(i >> 16);
+	color->rgba[3] = 255;
+}
+
+//! Creates the entities, returns `0` on success
+static int	create_entities(s_ecs* ecs, t_ecs_entity* entities)
+{
+	uint32_t mask;
+	size_t i;
+
+	for (i = 0; i < ECS_ENTITIES; ++i)
+	{
+		mask = entity_mask(i);
+		if ((entities[i] = ecs_create(ecs, mask)) == ECS_NONE)
+			return -1;
+		entity_init(i, (s_ecs_transform*)ecs_get(ecs, entities[i], ECS_TRANSFORM),
+			(s_ecs_color*)ecs_get(ecs, entities[i], ECS_COLOR));
+		if (mask & ECS_BIT(ECS_SPIN))
+			*(float*)ecs_get(ecs, entities[i], ECS_SPIN) = 0.5f + (float)(i % 5) * 0.25f;
+	}
+	return 0;
+}
+
+//! Creates the objects, returns `0` on success
+static int	create_objects(s_object** objects)
+{
+	s_object* swap;
+	uint32_t mask;
+	size_t i, j;
+	unsigned int seed = 1;
+
+	for (i = 0; i < ECS_ENTITIES; ++i)
+	{
+		if (!(objects[i] = (s_object*)calloc(1, sizeof(s_object))))
+			return -1;
+		mask = entity_mask(i);
+		entity_init(i, &objects[i]->transform, &objects[i]->color);
+		objects[i]->shape = (i % 6 == 5 ? -1 : (int)(i % ENUMLENGTH_MESH_SHAPE));
+		objects[i]->spins = ((mask & ECS_BIT(ECS_SPIN)) != 0);
+		if (objects[i]->spins)
+			objects[i]->spin = 0.5f + (float)(i % 5) * 0.25f;
+	}
+	for (i = ECS_ENTITIES - 1; i > 0; --i)
+	{
+		seed = seed * 1103515245u + 12345u;
+		j = (seed >> 8) % (i + 1);
+		swap = objects[i];
+		objects[i] = objects[j];
+		objects[j] = swap;
+	}
+	return 0;
+}
+
+//! Turns the spinning entities, and moves every bounding sphere onto its transform
+static void	update_chunks(s_ecs_chunk** chunks, size_t begin, size_t end)
+{
+	s_ecs_transform* transforms;
+	s_ecs_bounds* bounds;
+	float const* spins;
+	uint32_t row;
+	size_t i;
+
+	for (i = begin; i < end; ++i)
+	{
+		transforms = (s_ecs_transform*)ecs_column(chunks[i], ECS_TRANSFORM);
+		bounds = (s_ecs_bounds*)ecs_column(chunks[i], ECS_BOUNDS);
+		if (chunks[i]->archetype->mask & ECS_BIT(ECS_SPIN))
+		{
+			spins = (float const*)ecs_column(chunks[i], ECS_SPIN);
+			for (row = 0; row < chunks[i]->count; ++row)
+				transforms[row].angle += spins[row] * ECS_DT;
+		}
+		for (row = 0; row < chunks[i]->count; ++row)
+		{
+			bounds[row].center[0] = transforms[row].position[0];
+			bounds[row].center[1] = transforms[row].position[1];
+			bounds[row].center[2] = transforms[row].position[2];
+			bounds[row].radius = transforms[row].scale * ECS_RADIUS;
+		}
+	}
+}
+
+static void	update_job(void* data, size_t begin, size_t end)
+{
+	update_chunks((s_ecs_chunk**)data, begin, end);
+}
+
+static void	update_objects(s_object** objects)
+{
+	s_object* object;
+	size_t i;
+
+	for (i = 0; i < ECS_ENTITIES; ++i)
+	{
+		object = objects[i];
+		if (object->spins)
+			object->transform.angle += object->spin * ECS_DT;
+		object->bounds.center[0] = object->transform.position[0];
+		object->bounds.center[1] = object->transform.position[1];
+		object->bounds.center[2] = object->transform.position[2];
+		object->bounds.radius = object->transform.scale * ECS_RADIUS;
+	}
+}
+
+//! Fills in the instances of a mesh's entities, returns their amount
+static size_t	fill_entities(s_ecs* ecs, int shape, s_mesh_instance* instances)
+{
+	s_ecs_transform const* transforms;
+	s_ecs_color const* colors;
+	s_ecs_query query;
+	s_ecs_chunk* chunk;
+	size_t count = 0;
+	uint32_t row;
+
+	ecs_query_init(&query, ecs, ECS_BIT(ECS_TRANSFORM) | ECS_BIT(ECS_COLOR) | ECS_BIT(ECS_MESH + shape));
+	while ((chunk = ecs_query_next(&query)))
+	{
+		transforms = (s_ecs_transform const*)ecs_column(chunk, ECS_TRANSFORM);
+		colors = (s_ecs_color const*)ecs_column(chunk, ECS_COLOR);
+		for (row = 0; row < chunk->count; ++row, ++count)
+		{
+			mesh_instance_place(&instances[count], transforms[row].position, transforms[row].scale,
+				transforms[row].angle);
+			memcpy(instances[count].color, colors[row].rgba, 4);
+		}
+	}
+	return count;
+}
+
+static size_t	fill_objects(s_object** objects, int shape, s_mesh_instance* instances)
+{
+	size_t count = 0;
+	size_t i;
+
+	for (i = 0; i < ECS_ENTITIES; ++i)
+	{
+		if (objects[i]->shape != shape)
+			continue;
+		mesh_instance_place(&instances[count], objects[i]->transform.position, objects[i]->transform.scale,
+			objects[i]->transform.angle);
+		memcpy(instances[count].color, objects[i]->color.rgba, 4);
+		++count;
+	}
+	return count;
+}
+
+//! Returns a checksum of instances which does not depend on their order
+static uint32_t	checksum(s_mesh_instance const* instances, size_t count)
+{
+	uint32_t words[sizeof(s_mesh_instance) / sizeof(uint32_t)];
+	uint32_t sum = 0;
+	size_t i, j;
+
+	for (i = 0; i < count; ++i)
+	{
+		memcpy(words, &instances[i], sizeof(words));
+		for (j = 0; j < sizeof(words) / sizeof(uint32_t); ++j)
+			sum ^= words[j] * (uint32_t)(2 * j + 1);
+	}
+	return sum;
+}
+
+//! Checks that every entity which is alive is where its record says, and that the dead ones are not, returns `0` if so
+static int	check(s_ecs* ecs, t_ecs_entity const* entities)
+{
+	s_ecs_query query;
+	s_ecs_chunk* chunk;
+	size_t alive = 0, stored = 0;
+	size_t i;
+	uint32_t row;
+
+	for (i = 0; i < ECS_ENTITIES; ++i)
+	{
+		if (i % 10 == 0)
+		{
+			if (ecs_alive(ecs, entities[i]))
+				return -1;
+			continue;
+		}
+		if (!ecs_alive(ecs, entities[i]) ||
+			((s_ecs_color*)ecs_get(ecs, entities[i], ECS_COLOR))->rgba[0] != (uint8_t)i ||
+			((s_ecs_color*)ecs_get(ecs, entities[i], ECS_COLOR))->rgba[1] != (uint8_t)(i >> 8))
+			return -1;
+		++alive;
+	}
+	ecs_query_init(&query, ecs, 0);
+	while ((chunk = ecs_query_next(&query)))
+	{
+		for (row = 0; row < chunk->count; ++row)
+		{
+			if (ecs_get(ecs, ecs_chunk_entities(chunk)[row], ECS_TRANSFORM) !=
+				(s_ecs_transform*)ecs_column(chunk, ECS_TRANSFORM) + row)
+				return -1;
+		}
+		stored += chunk->count;
+	}
+	return (alive == ecs->count && stored == alive ? 0 : -1);
+}
+
+//! Times the entities against the objects, returns `0` on success
+static int	run(s_ecs* ecs, t_ecs_entity* entities, s_object** objects, s_mesh_instance* instances,
+	s_mesh_instance* expected)
+{
+	static s_ecs_chunk* chunks[ECS_ENTITIES / 64];
+	static s_jobs jobs;
+	double samples[ECS_RUNS];
+	char label[64];
+	double start;
+	size_t count = 0, expected_count = 0;
+	size_t chunk_count;
+	int threads = jobs_cpu_count();
+	int shape;
+	int i;
+
+	start = bench_time();
+	if (create_objects(objects))
+	{
+		fprintf(stderr, "error: could not allocate the objects\n");
+		return -1;
+	}
+	printf("objects: created in %.1f ms\n", bench_time() - start);
+	start = bench_time();
+	if (create_entities(ecs, entities))
+		return -1;
+	printf("entities: created in %.1f ms, %d archetypes, %zu chunks of %d bytes\n", bench_time() - start,
+		ecs->archetype_count, ecs_chunks(ecs, 0, NULL, 0), ECS_CHUNK_SIZE);
+	/* one update: the objects chase a pointer per entity, the entities stream through their arrays */
+	for (i = -1; i < ECS_RUNS; ++i)
+	{
+		start = bench_time();
+		update_objects(objects);
+		if (i >= 0)
+			samples[i] = bench_time() - start;
+	}
+	bench_report("objects: update", samples, ECS_RUNS);
+	chunk_count = ecs_chunks(ecs, ECS_BIT(ECS_TRANSFORM) | ECS_BIT(ECS_BOUNDS), chunks, ECS_ENTITIES / 64);
+	for (i = -1; i < ECS_RUNS; ++i)
+	{
+		start = bench_time();
+		update_chunks(chunks, 0, chunk_count);
+		if (i >= 0)
+			samples[i] = bench_time() - start;
+	}
+	bench_report("entities: update", samples, ECS_RUNS);
+	if (jobs_init(&jobs, threads))
+		return -1;
+	for (i = -1; i < ECS_RUNS; ++i)
+	{
+		start = bench_time();
+		jobs_parallel_for(&jobs, chunk_count, ECS_GRAIN, update_job, chunks);
+		if (i >= 0)
+			samples[i] = bench_time() - start;
+	}
+	jobs_free(&jobs);
+	snprintf(label, sizeof(label), "entities: update, %d thread%s", threads, (threads > 1 ? "s" : ""));
+	bench_report(label, samples, ECS_RUNS);
+	/* the same angles in both: each was updated 2 * (ECS_RUNS + 1) times, the objects 1 * (ECS_RUNS + 1) */
+	for (i = -1; i < ECS_RUNS; ++i)
+		update_objects(objects);
+	/* the instances of each mesh: the objects are shuffled, so the instances are compared regardless of their order */
+	for (shape = 0; shape < ENUMLENGTH_MESH_SHAPE; ++shape)
+	{
+		for (i = -1; i < ECS_RUNS; ++i)
+		{
+			start = bench_time();
+			expected_count = fill_objects(objects, shape, expected);
+			if (i >= 0)
+				samples[i] = bench_time() - start;
+		}
+		if (shape == 0)
+			bench_report("objects: fill a mesh", samples, ECS_RUNS);
+		for (i = -1; i < ECS_RUNS; ++i)
+		{
+			start = bench_time();
+			count = fill_entities(ecs, shape, instances);
+			if (i >= 0)
+				samples[i] = bench_time() - start;
+		}
+		if (shape == 0)
+			bench_report("entities: fill a mesh", samples, ECS_RUNS);
+		if (count != expected_count || checksum(instances, count) != checksum(expected, count))
+		{
+			fprintf(stderr, "error: the instances of mesh %d differ (%zu rather than %zu)\n",
+				shape, count, expected_count);
+			return -1;
+		}
+	}
+	/* a tenth of the entities are destroyed, which moves others around: each must still be found */
+	start = bench_time();
+	for (i = 0; i < ECS_ENTITIES; i += 10)
+		ecs_destroy(ecs, entities[i]);
+	printf("entities: %d destroyed in %.1f ms\n", ECS_ENTITIES / 10, bench_time() - start);
+	if (check(ecs, entities))
+	{
+		fprintf(stderr, "error: the entities are not where their records say\n");
+		return -1;
+	}
+	return 0;
+}
+
+int	bench_ecs(s_config const* config)
+{
+	static s_ecs ecs;
+	t_ecs_entity* entities;
+	s_object** objects;
+	s_mesh_instance* instances;
+	s_mesh_instance* expected;
+	int status = -1;
+	size_t i;
+
+	(void)config;
+	ecs_init(&ecs);
+	entities = (t_ecs_entity*)malloc(ECS_ENTITIES * sizeof(t_ecs_entity));
+	objects = (s_object**)calloc(ECS_ENTITIES, sizeof(s_object*));
+	instances = (s_mesh_instance*)malloc(ECS_ENTITIES * sizeof(s_mesh_instance));
+	expected = (s_mesh_instance*)malloc(ECS_ENTITIES * sizeof(s_mesh_instance));
+	printf("%d entities, a transform, bounds and a color each, most with a mesh, half with a spin\n",
+		ECS_ENTITIES);
+	if (entities && objects && instances && expected)
+		status = run(&ecs, entities, objects, instances, expected);
+	ecs_free(&ecs);
+	if (objects)
+	{
+		for (i = 0; i < ECS_ENTITIES; ++i)
+			free(objects[i]);
+	}
+	free(objects);
+	free(entities);
+	free(instances);
+	free(expected);
+	return status;
+}
@@ -0,0 +1,150 @@
+
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include <pthread.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#include <time.h>
+#endif
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "damage.h"
+#include "bench/bench.h"
+
+#define IDLE_SECONDS	1
+#define WAKE_RUNS		50
+#define WAKE_DELAY_MS	2
+
+//! A thread which marks the frame dirty after a short delay, as a worker finishing a job would
+typedef struct poster
+{
+	s_damage*		damage;
+	pthread_t		thread;
+	_Atomic double	posted;	//!< The time at which the damage was posted, in milliseconds
+}	s_poster;
+
+//! Returns the CPU time used by this process so far (user and system), in milliseconds
+static double	process_cpu_time(void)
+{
+#if defined(_WIN32)
+	FILETIME creation, exit, kernel, user;
+	ULARGE_INTEGER k, u;
+	GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+	k.LowPart = kernel.dwLowDateTime; k.HighPart = kernel.dwHighDateTime;
+	u.LowPart = user.dwLowDateTime;   u.HighPart = user.dwHighDateTime;
+	return (double)(k.QuadPart + u.QuadPart) / 10000.;
+#else
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return (double)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000. +
+		(double)(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.;
+#endif
+}
+
+static void*	poster_run(void* argument)
+{
+	s_poster* poster = (s_poster*)argument;
+#if defined(_WIN32)
+	Sleep(WAKE_DELAY_MS);
+#else
+	struct timespec delay = { 0, WAKE_DELAY_MS * 1000000L };
+	nanosleep(&delay, NULL);
+#endif
+	atomic_store(&poster->posted, bench_time());
+	damage_post(poster->damage);
+	return NULL;
+}
+
+//! Redraws constantly for `IDLE_SECONDS`, returns the CPU usage as a percentage of one core
+static double	busy_cpu_usage(s_window* window)
+{
+	double start = bench_time();
+	double cpu = process_cpu_time();
+
+	while (bench_time() - start < IDLE_SECONDS * 1000.)
+	{
+		window_poll_events();
+		glClear(GL_COLOR_BUFFER_BIT);
+		window_swap_buffers(window);
+	}
+	glFinish();
+	return (process_cpu_time() - cpu) * 100. / (bench_time() - start);
+}
+
+//! Waits for an undamaged frame for `IDLE_SECONDS`, returns the CPU usage as a percentage of one core
+static double	idle_cpu_usage(s_window* window, s_damage* damage)
+{
+	double start = bench_time();
+	double cpu = process_cpu_time();
+
+	damage_schedule(damage, window_timer_value() + IDLE_SECONDS * window_timer_frequency());
+	if (!damage_wait(damage, window))
+		return -1.;
+	return (process_cpu_time() - cpu) * 100. / (bench_time() - start);
+}
+
+int	bench_idle(s_config const* config)
+{
+	static double samples[2][WAKE_RUNS];
+	s_poster poster;
+	s_damage damage;
+	s_window* window;
+	double busy, idle;
+	uint64_t deadline;
+	int i;
+
+	(void)config;
+	if (window_init())
+		return -1;
+	window = window_create(64, 64, "bench: idle", 0);
+	if (!window)
+	{
+		window_terminate();
+		return -1;
+	}
+	window_make_current(window);
+	if (!window_load_gl(window, 0))
+	{
+		window_destroy(window);
+		window_terminate();
+		return -1;
+	}
+	/* the first frame is always dirty */
+	damage_init(&damage);
+	damage_wait(&damage, window);
+	busy = busy_cpu_usage(window);
+	idle = idle_cpu_usage(window, &damage);
+	poster.damage = &damage;
+	for (i = 0; i < WAKE_RUNS && idle >= 0.; ++i)
+	{
+		/* wake-up from another thread, through an empty event */
+		if (pthread_create(&poster.thread, NULL, poster_run, &poster))
+			break;
+		if (!damage_wait(&damage, window))
+			break;
+		samples[0][i] = bench_time() - atomic_load(&poster.posted);
+		pthread_join(poster.thread, NULL);
+		/* wake-up for an animation deadline: how late it was reached */
+		deadline = window_timer_value() + window_timer_frequency() * WAKE_DELAY_MS / 1000;
+		damage_schedule(&damage, deadline);
+		if (!damage_wait(&damage, window))
+			break;
+		samples[1][i] = (double)(window_timer_value() - deadline) * 1000. / (double)window_timer_frequency();
+	}
+	if (i == WAKE_RUNS)
+	{
+		printf("%-32s %6.1f %% of a core\n", "busy loop: CPU usage", busy);
+		printf("%-32s %6.1f %% of a core\n", "idle loop: CPU usage", idle);
+		bench_report("wake-up: posted event", samples[0], WAKE_RUNS);
+		bench_report("wake-up: deadline (lateness)", samples[1], WAKE_RUNS);
+	}
+	window_destroy(window);
+	gladUnloadGL();
+	window_terminate();
+	return (i == WAKE_RUNS ? 0 : -1);
+}
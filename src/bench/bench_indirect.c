@@ -0,0 +1,225 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "draw_commands.h"
+#include "meshes.h"
+#include "bench/bench.h"
+
+#define INDIRECT_FRAMES		10
+#define INDIRECT_OBJECTS	50000
+
+//! The ways of submitting the same objects which are compared
+typedef enum submission
+{
+	SUBMISSION_DIRECT,			//!< One `glDrawElementsInstancedBaseVertexBaseInstance()` per object
+	SUBMISSION_INDIRECT,		//!< One `glDrawElementsIndirect()` per object
+	SUBMISSION_MULTI_INDIRECT,	//!< One `glMultiDrawElementsIndirect()` for all objects
+	SUBMISSION_MERGED,			//!< Likewise, with the objects sorted by mesh: the builder merges them into instanced commands
+	ENUMLENGTH_SUBMISSION
+}	e_submission;
+
+static char const* const	submission_names[ENUMLENGTH_SUBMISSION] =
+{
+	"direct",
+	"indirect",
+	"multi-draw",
+	"multi-draw, merged",
+};
+
+//! The scene: static instance data, and the objects which refer to it
+typedef struct indirect_scene
+{
+	s_mesh				mesh;	//!< All of the built-in shapes, in shared buffers
+	s_draw_range		ranges[ENUMLENGTH_MESH_SHAPE];
+	GLuint				instances;	//!< The instance buffer, one per object
+	s_draw_object*		objects;	//!< Interleaved shapes: no two consecutive objects can share a command
+	s_draw_object*		sorted;		//!< The same objects, grouped by shape
+}	s_indirect_scene;
+
+static int	create_scene(s_indirect_scene* scene)
+{
+	s_mesh_instance* instances;
+	float position[3];
+	size_t i, j;
+	int shape;
+
+	instances = (s_mesh_instance*)malloc(INDIRECT_OBJECTS * sizeof(s_mesh_instance));
+	scene->objects = (s_draw_object*)malloc(INDIRECT_OBJECTS * sizeof(s_draw_object));
+	scene->sorted = (s_draw_object*)malloc(INDIRECT_OBJECTS * sizeof(s_draw_object));
+	if (!instances || !scene->objects || !scene->sorted || mesh_create_shapes(&scene->mesh, scene->ranges))
+	{
+		free(instances);
+		return -1;
+	}
+	/* a grid of small objects, so that the rasterizer has little to do besides the draws */
+	for (i = 0; i < INDIRECT_OBJECTS; ++i)
+	{
+		position[0] = (float)(i % 250) / 125.f - 1.f;
+		position[1] = (float)(i / 250) / 100.f - 1.f;
+		position[2] = 0.f;
+		mesh_instance_place(&instances[i], position, 0.006f, (float)i);
+		instances[i].color[0] = (uint8_t)(i * 5);
+		instances[i].color[1] = (uint8_t)(i * 3);
+		instances[i].color[2] = (uint8_t)(i * 7);
+		instances[i].color[3] = 255;
+		scene->objects[i].range = (uint32_t)(i % ENUMLENGTH_MESH_SHAPE);
+		scene->objects[i].instance = (uint32_t)i;
+	}
+	j = 0;
+	for (shape = 0; shape < ENUMLENGTH_MESH_SHAPE; ++shape)
+	{
+		for (i = (size_t)shape; i < INDIRECT_OBJECTS; i += ENUMLENGTH_MESH_SHAPE)
+			scene->sorted[j++] = scene->objects[i];
+	}
+	/* sorted by shape, the instances must be too, for the builder to merge them */
+	for (i = 0; i < INDIRECT_OBJECTS; ++i)
+		scene->sorted[i].instance = (uint32_t)i;
+	glGenBuffers(1, &scene->instances);
+	gl_state_bind_buffer(GL_ARRAY_BUFFER, scene->instances);
+	glBufferData(GL_ARRAY_BUFFER, INDIRECT_OBJECTS * sizeof(s_mesh_instance), instances, GL_STATIC_DRAW);
+	free(instances);
+	return 0;
+}
+
+static void	free_scene(s_indirect_scene* scene)
+{
+	if (scene->instances)
+		gl_state_delete_buffers(1, &scene->instances);
+	mesh_free(&scene->mesh);
+	free(scene->objects);
+	free(scene->sorted);
+}
+
+static void	submit_direct(s_indirect_scene const* scene)
+{
+	s_draw_range const* range;
+	size_t i;
+
+	for (i = 0; i < INDIRECT_OBJECTS; ++i)
+	{
+		range = &scene->ranges[scene->objects[i].range];
+		glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, (GLsizei)range->index_count, GL_UNSIGNED_SHORT,
+			(void const*)(range->first_index * sizeof(uint16_t)), 1, range->base_vertex, scene->objects[i].instance);
+	}
+}
+
+static int	run(s_window* window, s_indirect_scene* scene, s_draw_commands* commands, GLuint program,
+	e_submission submission)
+{
+	static double samples[2][INDIRECT_FRAMES];
+	int const multi_draw_indirect = gl_caps.multi_draw_indirect;
+	char label[64];
+	double start, submitted;
+	long draw_calls, drawn;
+	int frame;
+	int status = 0;
+
+	if (submission == SUBMISSION_INDIRECT)
+		gl_caps.multi_draw_indirect = 0;
+	else if (submission != SUBMISSION_DIRECT && !multi_draw_indirect)
+		return 0;
+	draw_calls = commands->draw_calls;
+	drawn = commands->commands;
+	/* one more frame than measured, to warm up the driver */
+	for (frame = -1; frame < INDIRECT_FRAMES && status == 0; ++frame)
+	{
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		start = bench_time();
+		gl_state_use_program(program);
+		mesh_bind_instances(&scene->mesh, scene->instances);
+		if (submission == SUBMISSION_DIRECT)
+			submit_direct(scene);
+		else
+			status = draw_commands_submit(commands, GL_TRIANGLES, scene->ranges,
+				(submission == SUBMISSION_MERGED ? scene->sorted : scene->objects), INDIRECT_OBJECTS);
+		submitted = bench_time();
+		window_swap_buffers(window);
+		glFinish();
+		if (frame >= 0)
+		{
+			samples[0][frame] = submitted - start;
+			samples[1][frame] = bench_time() - start;
+		}
+	}
+	gl_caps.multi_draw_indirect = multi_draw_indirect;
+	if (status)
+		return -1;
+	if (submission == SUBMISSION_DIRECT)
+	{
+		draw_calls = INDIRECT_OBJECTS;
+		drawn = INDIRECT_OBJECTS;
+	}
+	else
+	{
+		draw_calls = (commands->draw_calls - draw_calls) / (INDIRECT_FRAMES + 1);
+		drawn = (commands->commands - drawn) / (INDIRECT_FRAMES + 1);
+	}
+	snprintf(label, sizeof(label), "%s: submit", submission_names[submission]);
+	bench_report(label, samples[0], INDIRECT_FRAMES);
+	snprintf(label, sizeof(label), "%s: frame", submission_names[submission]);
+	bench_report(label, samples[1], INDIRECT_FRAMES);
+	/* the samples are sorted by now */
+	printf("%-32s %ld commands | %ld draw calls/frame | submit: %.3f us/object\n", "", drawn, draw_calls,
+		samples[0][INDIRECT_FRAMES / 2] * 1000. / INDIRECT_OBJECTS);
+	return 0;
+}
+
+int	bench_indirect(s_config const* config)
+{
+	s_indirect_scene scene = { 0 };
+	s_draw_commands commands;
+	s_meshes meshes;
+	s_window* window;
+	s_mat4 identity;
+	int status = -1;
+	int submission;
+
+	if (window_init())
+		return -1;
+	window = window_create(config->width, config->height, "bench: indirect", 0);
+	if (!window)
+	{
+		window_terminate();
+		return -1;
+	}
+	window_make_current(window);
+	if (window_load_gl(window, 0))
+	{
+		gl_caps_init();
+		gl_state_init();
+		printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+		if (!gl_caps.base_instance)
+			fprintf(stderr, "error: indirect draws need a base instance (GL 4.2 or ARB_base_instance)\n");
+		/* the instanced mesh renderer is only used for its program */
+		else if (meshes_init(&meshes, 1) == 0)
+		{
+			if (draw_commands_init(&commands, INDIRECT_OBJECTS) == 0)
+			{
+				if (create_scene(&scene) == 0)
+				{
+					mat4_identity(&identity);
+					gl_state_use_program(meshes.program);
+					glUniformMatrix4fv(meshes.view_projection_location, 1, GL_FALSE, identity.m);
+					gl_state_enable(GL_DEPTH_TEST, 1);
+					gl_state_enable(GL_CULL_FACE, 0);
+					status = 0;
+					for (submission = 0; submission < ENUMLENGTH_SUBMISSION && status == 0; ++submission)
+						status = run(window, &scene, &commands, meshes.program, (e_submission)submission);
+				}
+				free_scene(&scene);
+				draw_commands_free(&commands);
+			}
+			meshes_free(&meshes);
+		}
+	}
+	window_destroy(window);
+	gladUnloadGL();
+	window_terminate();
+	return status;
+}
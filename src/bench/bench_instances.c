@@ -0,0 +1,183 @@
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "meshes.h"
+#include "bench/bench.h"
+
+#define INSTANCE_FRAMES	5
+#define INSTANCE_COUNT	100000
+
+//! The objects to draw, generated once so that only the drawing is measured
+typedef struct instance_job
+{
+	s_mesh_instance	instance;
+	int				shape;
+}	s_instance_job;
+
+static void	generate(s_instance_job* jobs)
+{
+	float position[3];
+	int i;
+
+	for (i = 0; i < INSTANCE_COUNT; ++i)
+	{
+		position[0] = (float)(i % 50) * 1.5f - 37.5f;
+		position[1] = (float)(i / 2500) * 1.5f - 30.f;
+		position[2] = (float)(i / 50 % 50) * 1.5f - 37.5f;
+		jobs[i].shape = i % ENUMLENGTH_MESH_SHAPE;
+		mesh_instance_place(&jobs[i].instance, position, 0.8f, (float)i * 0.1f);
+		jobs[i].instance.color[0] = (uint8_t)(i * 5);
+		jobs[i].instance.color[1] = (uint8_t)(i * 3);
+		jobs[i].instance.color[2] = (uint8_t)(i * 7);
+		jobs[i].instance.color[3] = 255;
+	}
+}
+
+//! Sets up the camera, which sees the whole grid
+static void	view_projection(s_mat4* result, int width, int height)
+{
+	static float const	eye[3] = { 70.f, 50.f, 70.f };
+	static float const	target[3] = { 0.f, 0.f, 0.f };
+	static float const	up[3] = { 0.f, 1.f, 0.f };
+	s_mat4 view;
+
+	mat4_perspective(result, 0.8f, (float)width / (float)height, 0.5f, 300.f);
+	mat4_look_at(&view, eye, target, up);
+	mat4_multiply(result, result, &view);
+}
+
+//! Draws every object with its own draw call, the instance data being set as constant vertex attributes
+static void	draw_naive(s_meshes* meshes, s_mesh const* shapes, GLuint const* vertex_arrays,
+	s_instance_job const* jobs, s_mat4 const* camera)
+{
+	s_mesh_instance const* instance;
+	int i;
+
+	gl_state_use_program(meshes->program);
+	glUniformMatrix4fv(meshes->view_projection_location, 1, GL_FALSE, camera->m);
+	gl_state_enable(GL_DEPTH_TEST, 1);
+	gl_state_enable(GL_CULL_FACE, 1);
+	gl_state_enable(GL_BLEND, 0);
+	for (i = 0; i < INSTANCE_COUNT; ++i)
+	{
+		instance = &jobs[i].instance;
+		gl_state_bind_vertex_array(vertex_arrays[jobs[i].shape]);
+		glVertexAttrib4fv(2, instance->transform[0]);
+		glVertexAttrib4fv(3, instance->transform[1]);
+		glVertexAttrib4fv(4, instance->transform[2]);
+		glVertexAttrib4Nubv(5, instance->color);
+		glDrawElements(GL_TRIANGLES, shapes[jobs[i].shape].index_count, GL_UNSIGNED_SHORT, NULL);
+	}
+}
+
+static void	draw_instanced(s_meshes* meshes, s_mesh* shapes, s_instance_job const* jobs, s_mat4 const* camera)
+{
+	int i;
+
+	meshes_begin(meshes, camera);
+	for (i = 0; i < INSTANCE_COUNT; ++i)
+		*meshes_add(meshes, &shapes[jobs[i].shape]) = jobs[i].instance;
+	meshes_end(meshes);
+}
+
+static void	run(s_window* window, s_meshes* meshes, s_mesh* shapes, GLuint const* vertex_arrays,
+	s_instance_job const* jobs, int instanced)
+{
+	static double samples[2][INSTANCE_FRAMES];
+	char label[64];
+	s_mat4 camera;
+	double start, submitted;
+	int width, height;
+	int frame;
+
+	window_framebuffer_size(window, &width, &height);
+	view_projection(&camera, width, height);
+	/* one more frame than measured, to warm up the driver */
+	for (frame = -1; frame < INSTANCE_FRAMES; ++frame)
+	{
+		start = bench_time();
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		if (instanced)
+			draw_instanced(meshes, shapes, jobs, &camera);
+		else
+			draw_naive(meshes, shapes, vertex_arrays, jobs, &camera);
+		submitted = bench_time();
+		window_swap_buffers(window);
+		glFinish();
+		if (frame >= 0)
+		{
+			samples[0][frame] = submitted - start;
+			samples[1][frame] = bench_time() - start;
+		}
+	}
+	snprintf(label, sizeof(label), "%s: submit (CPU)", (instanced ? "instanced" : "naive"));
+	bench_report(label, samples[0], INSTANCE_FRAMES);
+	snprintf(label, sizeof(label), "%s: frame", (instanced ? "instanced" : "naive"));
+	bench_report(label, samples[1], INSTANCE_FRAMES);
+	printf("%-32s %d objects | %ld draw calls/frame\n", "", INSTANCE_COUNT,
+		(instanced ? meshes->draw_calls : (long)INSTANCE_COUNT));
+}
+
+int	bench_instances(s_config const* config)
+{
+	s_mesh shapes[ENUMLENGTH_MESH_SHAPE];
+	GLuint vertex_arrays[ENUMLENGTH_MESH_SHAPE];
+	s_instance_job* jobs;
+	s_meshes meshes;
+	s_window* window;
+	int status = -1;
+	int i;
+
+	if (window_init())
+		return -1;
+	window = window_create(config->width, config->height, "bench: instances", 0);
+	if (!window)
+	{
+		window_terminate();
+		return -1;
+	}
+	window_make_current(window);
+	jobs = (s_instance_job*)malloc(INSTANCE_COUNT * sizeof(s_instance_job));
+	if (jobs && window_load_gl(window, 0))
+	{
+		gl_caps_init();
+		gl_state_init();
+		printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+		if (meshes_init(&meshes, INSTANCE_COUNT) == 0)
+		{
+			generate(jobs);
+			/* the naive draws use vertex arrays of their own, without the per-instance attributes */
+			glGenVertexArrays(ENUMLENGTH_MESH_SHAPE, vertex_arrays);
+			for (i = 0; i < ENUMLENGTH_MESH_SHAPE; ++i)
+			{
+				mesh_create_shape(&shapes[i], (e_mesh_shape)i);
+				gl_state_bind_vertex_array(vertex_arrays[i]);
+				gl_state_bind_buffer(GL_ARRAY_BUFFER, shapes[i].buffers[0]);
+				gl_state_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, shapes[i].buffers[1]);
+				glEnableVertexAttribArray(0);
+				glEnableVertexAttribArray(1);
+				glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(s_mesh_vertex), (void const*)offsetof(s_mesh_vertex, position));
+				glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(s_mesh_vertex), (void const*)offsetof(s_mesh_vertex, normal));
+			}
+			run(window, &meshes, shapes, vertex_arrays, jobs, 0);
+			run(window, &meshes, shapes, vertex_arrays, jobs, 1);
+			gl_state_delete_vertex_arrays(ENUMLENGTH_MESH_SHAPE, vertex_arrays);
+			for (i = 0; i < ENUMLENGTH_MESH_SHAPE; ++i)
+				mesh_free(&shapes[i]);
+			meshes_free(&meshes);
+			status = 0;
+		}
+	}
+	free(jobs);
+	window_destroy(window);
+	gladUnloadGL();
+	window_terminate();
+	return status;
+}
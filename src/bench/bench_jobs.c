@@ -0,0 +1,174 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "jobs.h"
+#include "meshes.h"
+#include "bench/bench.h"
+
+#define JOBS_RUNS		30
+//! The instances filled in per frame, like the instances scene
+#define JOBS_INSTANCES	100000
+//! The least instances which a job fills in
+#define JOBS_GRAIN		1024
+//! The jobs which each spawn `JOBS_CHILDREN` more, and wait for them
+#define JOBS_PARENTS	64
+#define JOBS_CHILDREN	64
+
+//! Fills in instances, as the instances scene does every frame
+static void	fill(void* data, size_t begin, size_t end)
+{
+	s_mesh_instance* instances = (s_mesh_instance*)data;
+	float position[3];
+	size_t i;
+
+	for (i = begin; i < end; ++i)
+	{
+		position[0] = (float)(i % 50) * 1.5f;
+		position[1] = (float)(i / 2500) * 1.5f;
+		position[2] = (float)(i / 50 % 50) * 1.5f;
+		mesh_instance_place(&instances[i], position, 0.8f, (float)i * 0.1f);
+		instances[i].color[0] = (uint8_t)i;
+		instances[i].color[1] = (uint8_t)(i >> 8);
+		instances[i].color[2] = (uint8_t)(i >> 16);
+		instances[i].color[3] = 255;
+	}
+}
+
+//! A tiny job, which only counts itself
+static void	child(void* data, size_t begin, size_t end)
+{
+	atomic_fetch_add_explicit((atomic_long*)data, (long)(end - begin), memory_order_relaxed);
+}
+
+typedef struct nested
+{
+	s_jobs*		jobs;
+	atomic_long	done;
+}	s_nested;
+
+//! Spawns `JOBS_CHILDREN` jobs, and waits for them (running jobs meanwhile)
+static void	parent(void* data, size_t begin, size_t end)
+{
+	s_nested* nested = (s_nested*)data;
+	s_job list[JOBS_CHILDREN];
+	s_job_counter counter;
+	size_t i;
+
+	(void)begin;
+	(void)end;
+	for (i = 0; i < JOBS_CHILDREN; ++i)
+	{
+		list[i].run = child;
+		list[i].data = &nested->done;
+		list[i].begin = 0;
+		list[i].end = 1;
+	}
+	atomic_init(&counter.pending, 0);
+	jobs_run(nested->jobs, list, JOBS_CHILDREN, &counter);
+	jobs_wait(nested->jobs, &counter);
+}
+
+//! Fills in the instances, then runs the nested jobs, on `threads` threads, returns `0` on success
+static int	run(int threads, s_mesh_instance* instances, s_mesh_instance const* expected, double* fill_median)
+{
+	static double samples[JOBS_RUNS];
+	static s_jobs jobs;
+	s_nested nested;
+	char label[64];
+	double start;
+	long executed, stolen;
+	int i;
+
+	if (jobs_init(&jobs, threads))
+		return -1;
+	for (i = -1; i < JOBS_RUNS; ++i)
+	{
+		memset(instances, 0, JOBS_INSTANCES * sizeof(s_mesh_instance));
+		start = bench_time();
+		jobs_parallel_for(&jobs, JOBS_INSTANCES, JOBS_GRAIN, fill, instances);
+		if (i >= 0)
+			samples[i] = bench_time() - start;
+	}
+	executed = atomic_load(&jobs.executed);
+	stolen = atomic_load(&jobs.stolen);
+	snprintf(label, sizeof(label), "%d thread%s%s: fill", threads, (threads > 1 ? "s" : ""),
+		(threads > jobs_cpu_count() ? " (more than CPUs)" : ""));
+	bench_report(label, samples, JOBS_RUNS);
+	*fill_median = samples[JOBS_RUNS / 2];
+	printf("  %.1f%% of the jobs were stolen\n", (double)stolen * 100. / (double)(executed ? executed : 1));
+	if (memcmp(instances, expected, JOBS_INSTANCES * sizeof(s_mesh_instance)))
+	{
+		fprintf(stderr, "error: the instances filled in by %d threads differ\n", threads);
+		jobs_free(&jobs);
+		return -1;
+	}
+	/* a tree of tiny jobs: what each job costs, when a job waits for the ones it spawned */
+	nested.jobs = &jobs;
+	for (i = -1; i < JOBS_RUNS; ++i)
+	{
+		atomic_init(&nested.done, 0);
+		start = bench_time();
+		jobs_parallel_for(&jobs, JOBS_PARENTS, 1, parent, &nested);
+		if (i >= 0)
+			samples[i] = bench_time() - start;
+		if (atomic_load(&nested.done) != JOBS_PARENTS * JOBS_CHILDREN)
+		{
+			fprintf(stderr, "error: %ld of the %d nested jobs were run\n",
+				atomic_load(&nested.done), JOBS_PARENTS * JOBS_CHILDREN);
+			jobs_free(&jobs);
+			return -1;
+		}
+	}
+	snprintf(label, sizeof(label), "  %d nested jobs", JOBS_PARENTS * (JOBS_CHILDREN + 1));
+	bench_report(label, samples, JOBS_RUNS);
+	jobs_free(&jobs);
+	return 0;
+}
+
+int	bench_jobs(s_config const* config)
+{
+	s_mesh_instance* instances;
+	s_mesh_instance* expected;
+	double samples[JOBS_RUNS];
+	double single = 0., median;
+	double start;
+	int cpus = jobs_cpu_count();
+	int threads;
+	int status = 0;
+	int i;
+
+	(void)config;
+	instances = (s_mesh_instance*)malloc(JOBS_INSTANCES * sizeof(s_mesh_instance));
+	expected = (s_mesh_instance*)calloc(JOBS_INSTANCES, sizeof(s_mesh_instance));
+	if (!instances || !expected)
+	{
+		free(instances);
+		free(expected);
+		return -1;
+	}
+	printf("%d instances filled in per run, in jobs of %d, on %d CPU%s\n", JOBS_INSTANCES, JOBS_GRAIN,
+		cpus, (cpus > 1 ? "s" : ""));
+	/* the plain loop, without the job system, as the reference */
+	for (i = -1; i < JOBS_RUNS; ++i)
+	{
+		start = bench_time();
+		fill(expected, 0, JOBS_INSTANCES);
+		if (i >= 0)
+			samples[i] = bench_time() - start;
+	}
+	bench_report("loop, no jobs: fill", samples, JOBS_RUNS);
+	/* from 1 thread up to twice as many as there are CPUs, to show where it stops scaling */
+	for (threads = 1; status == 0 && threads <= 2 * cpus && threads <= JOBS_MAX_THREADS; threads *= 2)
+	{
+		status = run(threads, instances, expected, &median);
+		if (threads == 1)
+			single = median;
+		else if (status == 0)
+			printf("  fill: %.2fx as fast as 1 thread\n", single / median);
+	}
+	free(instances);
+	free(expected);
+	return status;
+}
@@ -0,0 +1,86 @@
+
+#include <stdio.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "bench/bench.h"
+
+#define LOADER_RUNS	50
+
+//! Renders the same minimal frame as the example, so that its entry points get resolved
+static void	first_frame(void)
+{
+	glClearColor(0.f, 0.f, 0.f, 1.f);
+	glClear(GL_COLOR_BUFFER_BIT);
+	glFinish();
+}
+
+//! Destroys the window and creates a new one, as happens when the monitor configuration changes
+static s_window*	recreate_window(s_window* window)
+{
+	window_destroy(window);
+	window = window_create(64, 64, "bench: loader", 0);
+	if (window)
+		window_make_current(window);
+	return window;
+}
+
+int	bench_loader(s_config const* config)
+{
+	static double samples[5][LOADER_RUNS];
+	s_window* window;
+	double start;
+	int i;
+
+	(void)config;
+	if (window_init())
+		return -1;
+	window = window_create(64, 64, "bench: loader", 0);
+	if (!window)
+	{
+		window_terminate();
+		return -1;
+	}
+	window_make_current(window);
+	for (i = 0; i < LOADER_RUNS; ++i)
+	{
+		/* drop the cached function tables, so that every load is cold */
+		gladUnloadGL();
+		start = bench_time();
+		if (!window_load_gl(window, 0))
+			break;
+		samples[0][i] = bench_time() - start;
+		first_frame();
+		samples[1][i] = bench_time() - start;
+
+		gladUnloadGL();
+		start = bench_time();
+		if (!window_load_gl(window, 1))
+			break;
+		samples[2][i] = bench_time() - start;
+		first_frame();
+		samples[3][i] = bench_time() - start;
+
+		/* a new context for the same driver: its table comes from the cache */
+		if (!(window = recreate_window(window)))
+			break;
+		start = bench_time();
+		if (!window_load_gl(window, 1))
+			break;
+		samples[4][i] = bench_time() - start;
+	}
+	if (i == LOADER_RUNS)
+	{
+		printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+		bench_report("eager: load",                samples[0], LOADER_RUNS);
+		bench_report("eager: load + first frame",  samples[1], LOADER_RUNS);
+		bench_report("lazy: load",                 samples[2], LOADER_RUNS);
+		bench_report("lazy: load + first frame",   samples[3], LOADER_RUNS);
+		bench_report("lazy: reload for new context", samples[4], LOADER_RUNS);
+	}
+	window_destroy(window);
+	gladUnloadGL();
+	window_terminate();
+	return (i == LOADER_RUNS ? 0 : -1);
+}
@@ -0,0 +1,148 @@
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "readback.h"
+#include "bench/bench.h"
+
+#define READBACK_FRAMES	60
+
+//! The resolutions which frames are captured at
+static int const	resolutions[][2] =
+{
+	{ 1920, 1080 },
+	{ 3840, 2160 },
+};
+#define RESOLUTIONS	(sizeof(resolutions) / sizeof(resolutions[0]))
+
+//! What the consumer does with each frame: it reads all of it, as an encoder or a network sender would
+static void	consume(void* user, s_readback_frame const* frame)
+{
+	uint64_t const* words = (uint64_t const*)frame->pixels;
+	size_t count = frame->stride * (size_t)frame->height / sizeof(uint64_t);
+	uint64_t sum = 0;
+	size_t i;
+
+	for (i = 0; i < count; ++i)
+		sum += words[i];
+	*(uint64_t volatile*)user += sum;
+}
+
+//! Renders a frame: a clear, in a color which changes every frame
+static void	render(int frame)
+{
+	glClearColor((float)(frame % 7) / 7.f, (float)(frame % 11) / 11.f, (float)(frame % 13) / 13.f, 1.f);
+	glClear(GL_COLOR_BUFFER_BIT);
+}
+
+//! Prints the capture throughput, and the time which the render thread spent on each frame
+static void	report(char const* label, double elapsed, long frames, double* samples)
+{
+	printf("%-32s %7.1f frames/s captured (%ld of %d)\n", label, (double)frames * 1000. / elapsed,
+		frames, READBACK_FRAMES);
+	bench_report("  render thread: frame", samples, READBACK_FRAMES);
+}
+
+//! Captures each frame with `glReadPixels()` into client memory, which waits for the frame to be rendered
+static int	run_sync(s_window* window, int width, int height)
+{
+	static double samples[READBACK_FRAMES];
+	uint64_t sum = 0;
+	s_readback_frame capture;
+	double start, frame_start;
+	void* pixels;
+	int frame;
+
+	if (!(pixels = malloc((size_t)width * (size_t)height * 4)))
+		return -1;
+	capture.pixels = pixels;
+	capture.width = width;
+	capture.height = height;
+	capture.stride = (size_t)width * 4;
+	start = bench_time();
+	for (frame = 0; frame < READBACK_FRAMES; ++frame)
+	{
+		frame_start = bench_time();
+		render(frame);
+		gl_state_bind_framebuffer(GL_READ_FRAMEBUFFER, window_framebuffer(window));
+		glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+		capture.index = frame;
+		consume(&sum, &capture);
+		window_swap_buffers(window);
+		samples[frame] = bench_time() - frame_start;
+	}
+	report("glReadPixels, client memory", bench_time() - start, READBACK_FRAMES, samples);
+	free(pixels);
+	return 0;
+}
+
+//! Captures each frame into a ring of `slots` pixel buffers, handed to a consumer thread
+static int	run_ring(s_window* window, int width, int height, int slots)
+{
+	static double samples[READBACK_FRAMES];
+	uint64_t sum = 0;
+	s_readback readback;
+	char label[64];
+	double start, frame_start;
+	int frame;
+
+	if (readback_init(&readback, width, height, slots, consume, &sum))
+		return -1;
+	start = bench_time();
+	for (frame = 0; frame < READBACK_FRAMES; ++frame)
+	{
+		frame_start = bench_time();
+		render(frame);
+		readback_capture(&readback, window_framebuffer(window));
+		window_swap_buffers(window);
+		samples[frame] = bench_time() - frame_start;
+	}
+	/* the throughput counts the frames until the consumer is done with the last one */
+	readback_finish(&readback);
+	snprintf(label, sizeof(label), "pixel buffer ring, %d buffers", slots);
+	report(label, bench_time() - start, readback.captured, samples);
+	printf("%-32s dropped %ld frames, waited for the GPU %ld times\n", "", readback.dropped, readback.waits);
+	readback_free(&readback);
+	return 0;
+}
+
+int	bench_readback(s_config const* config)
+{
+	s_window* window;
+	int status = 0;
+	int slots;
+	size_t i;
+
+	(void)config;
+	if (window_init())
+		return -1;
+	for (i = 0; i < RESOLUTIONS && status == 0; ++i)
+	{
+		status = -1;
+		window = window_create(resolutions[i][0], resolutions[i][1], "bench: readback", 0);
+		if (!window)
+			break;
+		window_make_current(window);
+		if (window_load_gl(window, 0))
+		{
+			gl_caps_init();
+			gl_state_init();
+			if (i == 0)
+				printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+			printf("%dx%d, %d frames:\n", resolutions[i][0], resolutions[i][1], READBACK_FRAMES);
+			status = run_sync(window, resolutions[i][0], resolutions[i][1]);
+			for (slots = 2; slots <= 4 && status == 0; ++slots)
+				status = run_ring(window, resolutions[i][0], resolutions[i][1], slots);
+		}
+		window_destroy(window);
+		gladUnloadGL();
+	}
+	window_terminate();
+	return status;
+}
@@ -0,0 +1,132 @@
+
+#include <stdio.h>
+#include <string.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "gl_util.h"
+#include "gpu_ring.h"
+#include "bench/bench.h"
+
+#define RING_FRAMES		120
+#define RING_VERTICES	65536	//!< The amount of vertices streamed each frame (1 MiB)
+#define RING_BATCHES	4		//!< The amount of allocations (and draw calls) per frame
+
+static char const* const	vertex_shader =
+	"#version 330 core\n"
+	"layout(location = 0) in vec4 a_position;\n"
+	"void main()\n"
+	"{\n"
+	"	gl_Position = a_position;\n"
+	"	gl_PointSize = 1.;\n"
+	"}\n";
+
+static char const* const	fragment_shader =
+	"#version 330 core\n"
+	"out vec4 f_color;\n"
+	"void main()\n"
+	"{\n"
+	"	f_color = vec4(1.);\n"
+	"}\n";
+
+//! Streams `RING_VERTICES` points per frame through a ring which holds `frames` frames, without ever calling `glFinish()`
+static int	run(s_window* window, GLuint program, int frames, int persistent)
+{
+	static double samples[RING_FRAMES];
+	size_t const batch = RING_VERTICES / RING_BATCHES * 4 * sizeof(float);
+	char label[64];
+	s_gpu_ring ring;
+	GLuint vertex_array;
+	double start;
+	float* vertices;
+	size_t offset;
+	int frame, b, i;
+
+	gl_caps.buffer_storage = persistent;
+	if (gpu_ring_init(&ring, (size_t)frames * RING_BATCHES * batch))
+		return -1;
+	glGenVertexArrays(1, &vertex_array);
+	gl_state_bind_vertex_array(vertex_array);
+	gl_state_bind_buffer(GL_ARRAY_BUFFER, ring.buffer);
+	glEnableVertexAttribArray(0);
+	gl_state_use_program(program);
+	for (frame = 0; frame < RING_FRAMES; ++frame)
+	{
+		start = bench_time();
+		glClear(GL_COLOR_BUFFER_BIT);
+		for (b = 0; b < RING_BATCHES; ++b)
+		{
+			if (!(vertices = (float*)gpu_ring_alloc(&ring, batch, 4 * sizeof(float), &offset)))
+				break;
+			for (i = 0; i < RING_VERTICES / RING_BATCHES; ++i)
+			{
+				vertices[i * 4 + 0] = (float)((i * 7 + frame) % 256) / 128.f - 1.f;
+				vertices[i * 4 + 1] = (float)((i * 13 + b) % 256) / 128.f - 1.f;
+				vertices[i * 4 + 2] = 0.f;
+				vertices[i * 4 + 3] = 1.f;
+			}
+			gpu_ring_flush(&ring);
+			glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, (void const*)offset);
+			glDrawArrays(GL_POINTS, 0, RING_VERTICES / RING_BATCHES);
+		}
+		gpu_ring_fence(&ring);
+		window_swap_buffers(window);
+		samples[frame] = bench_time() - start;
+	}
+	gl_state_delete_vertex_arrays(1, &vertex_array);
+	snprintf(label, sizeof(label), "%s, %d frames: frame", (persistent ? "persistent" : "unsynchronized"), frames);
+	bench_report(label, samples, RING_FRAMES);
+	printf("%-32s waited %ld times in %d frames (%.3f ms in total)\n", "",
+		ring.waits, RING_FRAMES, ring.wait_ms);
+	gpu_ring_free(&ring);
+	return (frame == RING_FRAMES ? 0 : -1);
+}
+
+int	bench_ring(s_config const* config)
+{
+	s_window* window;
+	GLuint program = 0;
+	int buffer_storage;
+	int status = -1;
+	int frames;
+
+	(void)config;
+	if (window_init())
+		return -1;
+	window = window_create(256, 256, "bench: ring", 0);
+	if (!window)
+	{
+		window_terminate();
+		return -1;
+	}
+	window_make_current(window);
+	if (window_load_gl(window, 0))
+	{
+		gl_caps_init();
+		gl_state_init();
+		program = gl_create_program(vertex_shader, fragment_shader);
+	}
+	if (program)
+	{
+		printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+		buffer_storage = gl_caps.buffer_storage;
+		status = 0;
+		/* how many frames of data the ring must hold for the CPU to (almost) never wait */
+		for (frames = 1; frames <= 4 && status == 0; ++frames)
+		{
+			if (buffer_storage)
+				status = run(window, program, frames, 1);
+			if (status == 0)
+				status = run(window, program, frames, 0);
+		}
+		gl_caps.buffer_storage = buffer_storage;
+		glDeleteProgram(program);
+	}
+	window_destroy(window);
+	gladUnloadGL();
+	window_terminate();
+	return status;
+}
@@ -0,0 +1,299 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "gl_util.h"
+#include "shader_cache.h"
+#include "bench/bench.h"
+
+#define SHADER_FEATURES	4
+#define SHADER_VARIANTS	(1 << SHADER_FEATURES)
+
+//! How long a load may take before the programs which aren't ready are given up on, in milliseconds
+#define LOAD_TIMEOUT	30000.
+
+static char const* const	vertex_shader =
+	"#version 330 core\n"
+	"out vec2 v_uv;\n"
+	"void main()\n"
+	"{\n"
+	"	v_uv = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+	"	gl_Position = vec4(v_uv * 2. - 1., 0., 1.);\n"
+	"}\n";
+
+//! What is drawn with while the variants compile
+static char const* const	fallback_shader =
+	"#version 330 core\n"
+	"out vec4 f_color;\n"
+	"void main()\n"
+	"{\n"
+	"	f_color = vec4(0.5, 0.5, 0.5, 1.);\n"
+	"}\n";
+
+//! A shader with optional features, like a material system would have: each combination is a program
+static char const* const	fragment_shader =
+	"#version 330 core\n"
+	"uniform sampler2D u_albedo;\n"
+	"uniform sampler2D u_normals;\n"
+	"uniform sampler2D u_shadow;\n"
+	"uniform vec3 u_light = vec3(0.37, 0.74, 0.56);\n"
+	"in vec2 v_uv;\n"
+	"out vec4 f_color;\n"
+	"void main()\n"
+	"{\n"
+	"	vec4 albedo = texture(u_albedo, v_uv);\n"
+	"	vec3 normal = vec3(0., 0., 1.);\n"
+	"#ifdef NORMAL_MAP\n"
+	"	normal = normalize(texture(u_normals, v_uv).xyz * 2. - 1.);\n"
+	"#endif\n"
+	"	float light = max(dot(normal, u_light), 0.);\n"
+	"#ifdef SPECULAR\n"
+	"	vec3 halfway = normalize(u_light + vec3(0., 0., 1.));\n"
+	"	light += pow(max(dot(normal, halfway), 0.), 32.);\n"
+	"#endif\n"
+	"#ifdef SHADOWS\n"
+	"	float lit = 0.;\n"
+	"	for (int y = -2; y <= 2; ++y)\n"
+	"		for (int x = -2; x <= 2; ++x)\n"
+	"			lit += step(0.5, texture(u_shadow, v_uv + vec2(x, y) / 1024.).r);\n"
+	"	light *= lit / 25.;\n"
+	"#endif\n"
+	"	vec3 color = albedo.rgb * (0.2 + light);\n"
+	"#ifdef FOG\n"
+	"	color = mix(color, vec3(0.5, 0.6, 0.7), smoothstep(0.2, 1., length(v_uv - 0.5)));\n"
+	"#endif\n"
+	"	f_color = vec4(color, albedo.a);\n"
+	"}\n";
+
+static char const* const	features[SHADER_FEATURES] =
+{
+	"NORMAL_MAP",
+	"SPECULAR",
+	"SHADOWS",
+	"FOG",
+};
+
+//! Defines the time the benchmark started at, so that its programs were never compiled before (by it, or by the driver's own cache)
+static char	nonce[64];
+
+//! Gives the programs new sources, which no cache has seen yet
+static void	renew_nonce(void)
+{
+	static int	count;
+
+	snprintf(nonce, sizeof(nonce), "BENCH_RUN %.0f_%d", bench_time(), count++);
+}
+
+//! Fills in the defines of a variant (with the nonce), as a `NULL`-terminated array
+static void	variant_defines(int variant, char const* defines[SHADER_FEATURES + 2])
+{
+	int count = 0;
+	int i;
+
+	defines[count++] = nonce;
+	for (i = 0; i < SHADER_FEATURES; ++i)
+	{
+		if (variant & (1 << i))
+			defines[count++] = features[i];
+	}
+	defines[count] = NULL;
+}
+
+//! Gets every variant of the program from the cache, and draws with each (drivers may only compile on first use)
+static int	get_programs(s_shader_cache* cache)
+{
+	char const* defines[SHADER_FEATURES + 2];
+	GLuint program;
+	int variant;
+
+	for (variant = 0; variant < SHADER_VARIANTS; ++variant)
+	{
+		variant_defines(variant, defines);
+		if (!(program = shader_cache_program(cache, vertex_shader, fragment_shader, defines)))
+			return -1;
+		gl_state_use_program(program);
+		glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	}
+	glFinish();
+	return 0;
+}
+
+//! Times getting all of the variants, and prints where they came from
+static int	run(s_shader_cache* cache, char const* label)
+{
+	long hits = cache->hits;
+	long loaded = cache->loaded;
+	long compiled = cache->compiled;
+	long stale = cache->stale;
+	double start = bench_time();
+	double elapsed;
+
+	if (get_programs(cache))
+		return -1;
+	elapsed = bench_time() - start;
+	printf("%-32s %9.3f ms | %7.3f ms/program | %ld compiled, %ld loaded, %ld in memory, %ld stale\n",
+		label, elapsed, elapsed / SHADER_VARIANTS, cache->compiled - compiled, cache->loaded - loaded,
+		cache->hits - hits, cache->stale - stale);
+	return 0;
+}
+
+//! Compares a cold startup (every program compiled) with warm ones (programs found in memory, or loaded from disk)
+static int	run_all(char const* directory)
+{
+	s_shader_cache cache;
+	int status;
+
+	renew_nonce();
+	if (shader_cache_init(&cache, directory, NULL))
+		return -1;
+	status = run(&cache, "cold (compile)");
+	if (status == 0)
+		status = run(&cache, "same run (in memory)");
+	shader_cache_free(&cache);
+	if (status || shader_cache_init(&cache, directory, NULL))
+		return -1;
+	status = run(&cache, "warm (program binaries)");
+	shader_cache_free(&cache);
+	/* as if the driver had been updated: every binary is stale */
+	if (status || shader_cache_init(&cache, directory, NULL))
+		return -1;
+	cache.driver ^= 1;
+	status = run(&cache, "other driver (recompile)");
+	/* these binaries can't be loaded by any driver: they would only take up space */
+	shader_cache_purge(&cache);
+	shader_cache_free(&cache);
+	return status;
+}
+
+//! Loads every variant like a level would: all of them are requested up front, then drawn with on every frame
+/*!
+**	A variant which isn't ready yet is drawn with `fallback`. The longest of the request and the frames is
+**	the hitch which the load causes.
+*/
+static int	run_load(s_shader_cache* cache, GLuint fallback, char const* label)
+{
+	static char const* const	modes[ENUMLENGTH_SHADER_COMPILE] = { "sync", "parallel", "thread" };
+	s_shader_program* programs[SHADER_VARIANTS];
+	char const* defines[SHADER_FEATURES + 2];
+	double start = bench_time();
+	double request, frame_start, elapsed;
+	double longest = 0.;
+	double ready = -1.;
+	long frames = 0;
+	GLuint program;
+	int waiting;
+	int variant;
+
+	renew_nonce();
+	for (variant = 0; variant < SHADER_VARIANTS; ++variant)
+	{
+		variant_defines(variant, defines);
+		if (!(programs[variant] = shader_cache_request(cache, vertex_shader, fragment_shader, defines)))
+			return -1;
+	}
+	request = bench_time() - start;
+	while (ready < 0. && bench_time() - start < LOAD_TIMEOUT)
+	{
+		frame_start = bench_time();
+		waiting = 0;
+		for (variant = 0; variant < SHADER_VARIANTS; ++variant)
+		{
+			if ((program = shader_cache_get(cache, programs[variant], fallback)) == fallback)
+				++waiting;
+			gl_state_use_program(program);
+			glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+		}
+		glFinish();
+		elapsed = bench_time() - frame_start;
+		longest = (elapsed > longest ? elapsed : longest);
+		++frames;
+		if (!waiting)
+			ready = bench_time() - start;
+	}
+	if (ready < 0.)
+	{
+		fprintf(stderr, "error: the programs were not ready after %.0f ms\n", LOAD_TIMEOUT);
+		return -1;
+	}
+	printf("%-32s request %9.3f ms | longest frame %9.3f ms | all ready %9.3f ms, after %ld frames (%s)\n",
+		label, request, longest, ready, frames, modes[cache->compile]);
+	return 0;
+}
+
+//! Compares loading the variants when they are requested, with compiling them in the background
+static int	run_loads(s_window* window)
+{
+	int const parallel = gl_caps.parallel_shader_compile;
+	s_shader_cache cache;
+	GLuint fallback;
+	int status;
+
+	if (!(fallback = gl_create_program(vertex_shader, fallback_shader)))
+		return -1;
+	/* the fallback is ready before the load starts: so is its first draw, which drivers may compile on */
+	gl_state_use_program(fallback);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	glFinish();
+	status = shader_cache_init(&cache, NULL, NULL);
+	if (status == 0)
+	{
+		status = run_load(&cache, fallback, "load, blocking");
+		shader_cache_free(&cache);
+	}
+	if (status == 0 && parallel && (status = shader_cache_init(&cache, NULL, window)) == 0)
+	{
+		status = run_load(&cache, fallback, "load, driver threads");
+		shader_cache_free(&cache);
+	}
+	/* as if the driver couldn't compile in the background by itself */
+	gl_caps.parallel_shader_compile = 0;
+	if (status == 0 && (status = shader_cache_init(&cache, NULL, window)) == 0)
+	{
+		status = run_load(&cache, fallback, "load, worker thread");
+		shader_cache_free(&cache);
+	}
+	gl_caps.parallel_shader_compile = parallel;
+	glDeleteProgram(fallback);
+	return status;
+}
+
+int	bench_shaders(s_config const* config)
+{
+	char const* directory = (config->shader_cache ? config->shader_cache : "shader-cache");
+	s_window* window;
+	GLuint vertex_array;
+	int status = -1;
+
+	if (window_init())
+		return -1;
+	window = window_create(64, 64, "bench: shaders", 0);
+	if (!window)
+	{
+		window_terminate();
+		return -1;
+	}
+	window_make_current(window);
+	if (window_load_gl(window, 0))
+	{
+		gl_caps_init();
+		gl_state_init();
+		printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+		printf("%d variants of one program, cache in '%s'%s\n", SHADER_VARIANTS, directory,
+			(gl_caps.program_binary ? "" : " (no program binaries: memory only)"));
+		glGenVertexArrays(1, &vertex_array);
+		gl_state_bind_vertex_array(vertex_array);
+		status = run_all(directory);
+		if (status == 0)
+			status = run_loads(window);
+		gl_state_delete_vertex_arrays(1, &vertex_array);
+	}
+	window_destroy(window);
+	gladUnloadGL();
+	window_terminate();
+	return status;
+}
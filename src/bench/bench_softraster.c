@@ -0,0 +1,325 @@
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "gl_util.h"
+#include "jobs.h"
+#include "softraster.h"
+#include "bench/bench.h"
+
+#define SOFTRASTER_WIDTH	1280
+#define SOFTRASTER_HEIGHT	720
+#define SOFTRASTER_QUADS	20000	//!< The amount of quads in the scene: half opaque, then half blended
+#define SOFTRASTER_QUAD		40		//!< The size of the quads, in pixels
+#define SOFTRASTER_TEXTURE	64		//!< The width and height of the texture
+#define SOFTRASTER_FRAMES	10
+
+//! Draws the vertices straight in framebuffer pixels, top row first, like the software rasterizer
+static char const* const	vertex_shader =
+	"#version 330 core\n"
+	"uniform vec2 u_viewport;\n"
+	"layout(location = 0) in vec3 a_position;\n"
+	"layout(location = 1) in vec2 a_uv;\n"
+	"layout(location = 2) in vec4 a_color;\n"
+	"out vec2 v_uv;\n"
+	"out vec4 v_color;\n"
+	"void main()\n"
+	"{\n"
+	"	v_uv = a_uv;\n"
+	"	v_color = a_color;\n"
+	"	gl_Position = vec4(a_position.x / u_viewport.x * 2.0 - 1.0, 1.0 - a_position.y / u_viewport.y * 2.0,\n"
+	"		a_position.z * 2.0 - 1.0, 1.0);\n"
+	"}\n";
+
+static char const* const	fragment_shader =
+	"#version 330 core\n"
+	"uniform sampler2D u_texture;\n"
+	"in vec2 v_uv;\n"
+	"in vec4 v_color;\n"
+	"out vec4 f_color;\n"
+	"void main()\n"
+	"{\n"
+	"	f_color = texture(u_texture, v_uv) * v_color;\n"
+	"}\n";
+
+static uint8_t const	clear_color[4] = { 32, 32, 48, 255 };
+
+static uint32_t	next_random(uint32_t* state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+//! Makes up a texture: a checkerboard, in a disc which fades out at its edge
+static void	make_texture(uint32_t* texels)
+{
+	uint8_t* texel;
+	float dx, dy, distance;
+	int x, y;
+
+	for (y = 0; y < SOFTRASTER_TEXTURE; ++y)
+	{
+		for (x = 0; x < SOFTRASTER_TEXTURE; ++x)
+		{
+			texel = (uint8_t*)&texels[y * SOFTRASTER_TEXTURE + x];
+			dx = ((float)x + 0.5f) / SOFTRASTER_TEXTURE - 0.5f;
+			dy = ((float)y + 0.5f) / SOFTRASTER_TEXTURE - 0.5f;
+			distance = sqrtf(dx * dx + dy * dy) * 2.f;
+			texel[0] = (uint8_t)(((x / 8 + y / 8) & 1) ? 255 : 96);
+			texel[1] = (uint8_t)(255 - y * 2);
+			texel[2] = (uint8_t)(x * 4);
+			texel[3] = (uint8_t)(distance >= 1.f ? 0 : 255.f * (1.f - distance * distance));
+		}
+	}
+}
+
+//! Generates the scene: rotated quads, as 2 triangles each, at random depths
+static void	generate(s_softraster_vertex* vertices)
+{
+	static float const	corners[6][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 0 }, { 1, 1 }, { 0, 1 } };
+	uint32_t random = 0x2545F491u;
+	s_softraster_vertex* vertex;
+	float cx, cy, z, angle, s, c, half;
+	uint32_t color;
+	int i, k;
+
+	half = SOFTRASTER_QUAD * 0.5f;
+	for (i = 0; i < SOFTRASTER_QUADS; ++i)
+	{
+		cx = (float)(next_random(&random) % SOFTRASTER_WIDTH);
+		cy = (float)(next_random(&random) % SOFTRASTER_HEIGHT);
+		z = (float)(next_random(&random) % 4096) / 4096.f;
+		angle = (float)(next_random(&random) % 628) / 100.f;
+		color = next_random(&random);
+		s = sinf(angle);
+		c = cosf(angle);
+		for (k = 0; k < 6; ++k)
+		{
+			vertex = &vertices[i * 6 + k];
+			vertex->x = cx + ((corners[k][0] - 0.5f) * c - (corners[k][1] - 0.5f) * s) * 2.f * half;
+			vertex->y = cy + ((corners[k][0] - 0.5f) * s + (corners[k][1] - 0.5f) * c) * 2.f * half;
+			vertex->z = z;
+			vertex->u = corners[k][0];
+			vertex->v = corners[k][1];
+			vertex->color[0] = (uint8_t)(128 | color);
+			vertex->color[1] = (uint8_t)(128 | (color >> 8));
+			vertex->color[2] = (uint8_t)(128 | (color >> 16));
+			/* the blended half of the quads is see-through */
+			vertex->color[3] = (uint8_t)(i < SOFTRASTER_QUADS / 2 ? 255 : 160);
+		}
+	}
+}
+
+//! Draws the scene with the software rasterizer, returns `0` on success
+static int	draw_soft(s_softraster* raster, s_softraster_vertex const* vertices, s_softraster_texture const* texture)
+{
+	int flags;
+	int i;
+
+	softraster_clear(raster, clear_color, 1.f);
+	for (i = 0; i < SOFTRASTER_QUADS * 2; ++i)
+	{
+		flags = (i < SOFTRASTER_QUADS ? SOFTRASTER_DEPTH_TEST | SOFTRASTER_DEPTH_WRITE :
+			SOFTRASTER_DEPTH_TEST | SOFTRASTER_BLEND);
+		if (softraster_triangle(raster, &vertices[i * 3], texture, flags))
+			return -1;
+	}
+	softraster_flush(raster);
+	return 0;
+}
+
+//! Draws the scene with GL, with the same states as the software rasterizer
+static void	draw_gl(s_window* window)
+{
+	glClearColor(clear_color[0] / 255.f, clear_color[1] / 255.f, clear_color[2] / 255.f, clear_color[3] / 255.f);
+	glClearDepth(1.);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	gl_state_enable(GL_DEPTH_TEST, 1);
+	gl_state_enable(GL_BLEND, 0);
+	glDepthMask(GL_TRUE);
+	glDrawArrays(GL_TRIANGLES, 0, SOFTRASTER_QUADS * 3);
+	gl_state_enable(GL_BLEND, 1);
+	gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	glDepthMask(GL_FALSE);
+	glDrawArrays(GL_TRIANGLES, SOFTRASTER_QUADS * 3, SOFTRASTER_QUADS * 3);
+	glDepthMask(GL_TRUE);
+	window_swap_buffers(window);
+	glFinish();
+}
+
+//! Times drawing the scene with GL, and reads back the last frame (flipped, top row first)
+static int	run_gl(s_window* window, s_softraster_vertex const* vertices, uint32_t const* texels, uint32_t* image)
+{
+	static double samples[SOFTRASTER_FRAMES];
+	GLuint vertex_array, buffer, program, texture;
+	double start;
+	int frame, y;
+
+	if (!(program = gl_create_program(vertex_shader, fragment_shader)))
+		return -1;
+	glGenVertexArrays(1, &vertex_array);
+	gl_state_bind_vertex_array(vertex_array);
+	glGenBuffers(1, &buffer);
+	gl_state_bind_buffer(GL_ARRAY_BUFFER, buffer);
+	glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(SOFTRASTER_QUADS * 6 * sizeof(s_softraster_vertex)), vertices, GL_STATIC_DRAW);
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glEnableVertexAttribArray(2);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(s_softraster_vertex), (void const*)offsetof(s_softraster_vertex, x));
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(s_softraster_vertex), (void const*)offsetof(s_softraster_vertex, u));
+	glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(s_softraster_vertex), (void const*)offsetof(s_softraster_vertex, color));
+	/* nearest filtering and repeat, like the software rasterizer */
+	texture = gl_create_texture_rgba8(SOFTRASTER_TEXTURE, SOFTRASTER_TEXTURE, texels);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	gl_state_use_program(program);
+	glUniform2f(glGetUniformLocation(program, "u_viewport"), SOFTRASTER_WIDTH, SOFTRASTER_HEIGHT);
+	glUniform1i(glGetUniformLocation(program, "u_texture"), 0);
+	gl_state_bind_texture(0, GL_TEXTURE_2D, texture);
+	gl_state_viewport(0, 0, SOFTRASTER_WIDTH, SOFTRASTER_HEIGHT);
+	for (frame = -1; frame < SOFTRASTER_FRAMES; ++frame)
+	{
+		start = bench_time();
+		draw_gl(window);
+		if (frame >= 0)
+			samples[frame] = bench_time() - start;
+	}
+	gl_state_bind_framebuffer(GL_READ_FRAMEBUFFER, window_framebuffer(window));
+	for (y = 0; y < SOFTRASTER_HEIGHT; ++y)
+	{
+		glReadPixels(0, SOFTRASTER_HEIGHT - 1 - y, SOFTRASTER_WIDTH, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+			image + (size_t)y * SOFTRASTER_WIDTH);
+	}
+	bench_report("gl: frame", samples, SOFTRASTER_FRAMES);
+	gl_state_delete_textures(1, &texture);
+	gl_state_delete_buffers(1, &buffer);
+	gl_state_delete_vertex_arrays(1, &vertex_array);
+	gl_state_use_program(0);
+	glDeleteProgram(program);
+	return 0;
+}
+
+//! Times drawing the scene with the software rasterizer, and compares the last frame with GL's (unless `image` is `NULL`)
+static int	run_soft(int threads, s_softraster_vertex const* vertices, s_softraster_texture const* texture,
+	uint32_t const* image)
+{
+	static double samples[SOFTRASTER_FRAMES];
+	s_softraster raster;
+	uint8_t const* soft;
+	uint8_t const* gl;
+	char label[64];
+	double start, error = 0.;
+	long differ = 0;
+	int frame, x, y, c, d, most;
+
+	if (softraster_init(&raster, SOFTRASTER_WIDTH, SOFTRASTER_HEIGHT, threads))
+		return -1;
+	for (frame = -1; frame < SOFTRASTER_FRAMES; ++frame)
+	{
+		start = bench_time();
+		if (draw_soft(&raster, vertices, texture))
+		{
+			softraster_free(&raster);
+			return -1;
+		}
+		if (frame >= 0)
+			samples[frame] = bench_time() - start;
+	}
+	snprintf(label, sizeof(label), "soft, %d thread%s: frame", threads, (threads > 1 ? "s" : ""));
+	bench_report(label, samples, SOFTRASTER_FRAMES);
+	printf("%-32s %.0f k triangles/s\n", "", (double)SOFTRASTER_QUADS * 2. / samples[SOFTRASTER_FRAMES / 2]);
+	for (y = 0; image && y < SOFTRASTER_HEIGHT; ++y)
+	{
+		for (x = 0; x < SOFTRASTER_WIDTH; ++x)
+		{
+			soft = (uint8_t const*)&raster.color[(size_t)y * (size_t)raster.stride + (size_t)x];
+			gl = (uint8_t const*)&image[(size_t)y * SOFTRASTER_WIDTH + (size_t)x];
+			for (c = 0, most = 0; c < 4; ++c)
+			{
+				d = abs((int)soft[c] - (int)gl[c]);
+				most = (d > most ? d : most);
+				error += (double)d;
+			}
+			differ += (most > 2);
+		}
+	}
+	if (image)
+		printf("%-32s compared with gl: mean error %.3f/255, %.3f%% of pixels off by more than 2/255\n", "",
+			error / ((double)SOFTRASTER_WIDTH * SOFTRASTER_HEIGHT * 4.),
+			(double)differ * 100. / ((double)SOFTRASTER_WIDTH * SOFTRASTER_HEIGHT));
+	softraster_free(&raster);
+	return 0;
+}
+
+//! Draws the scene with GL, if there is a GL driver, returns `0` if it did
+static int	run_gl_window(s_softraster_vertex const* vertices, uint32_t const* texels, uint32_t* image)
+{
+	s_window* window;
+	int status = -1;
+
+	if (window_init())
+		return -1;
+	window = window_create(SOFTRASTER_WIDTH, SOFTRASTER_HEIGHT, "bench: softraster", 0);
+	if (window)
+	{
+		window_make_current(window);
+		if (window_load_gl(window, 0))
+		{
+			gl_caps_init();
+			gl_state_init();
+			printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+			status = run_gl(window, vertices, texels, image);
+		}
+		window_destroy(window);
+		gladUnloadGL();
+	}
+	window_terminate();
+	return status;
+}
+
+int	bench_softraster(s_config const* config)
+{
+	static uint32_t texels[SOFTRASTER_TEXTURE * SOFTRASTER_TEXTURE];
+	s_softraster_texture texture = { texels, SOFTRASTER_TEXTURE, SOFTRASTER_TEXTURE };
+	s_softraster_vertex* vertices;
+	uint32_t* image;
+	int status = -1;
+	int threads;
+
+	(void)config;
+	make_texture(texels);
+	vertices = (s_softraster_vertex*)malloc(SOFTRASTER_QUADS * 6 * sizeof(s_softraster_vertex));
+	image = (uint32_t*)malloc((size_t)SOFTRASTER_WIDTH * SOFTRASTER_HEIGHT * 4);
+	if (vertices && image)
+	{
+		printf("%dx%d, %d textured quads (%d opaque, then %d blended), with a depth test\n",
+			SOFTRASTER_WIDTH, SOFTRASTER_HEIGHT, SOFTRASTER_QUADS, SOFTRASTER_QUADS / 2, SOFTRASTER_QUADS / 2);
+		generate(vertices);
+		/* on a host without a GL driver, the software rasterizer is measured alone */
+		if (run_gl_window(vertices, texels, image))
+		{
+			printf("%-32s no GL driver: the software rasterizer isn't compared with it\n", "gl:");
+			free(image);
+			image = NULL;
+		}
+		/* with 1 thread, then with a thread per CPU */
+		status = run_soft(1, vertices, &texture, image);
+		if (status == 0 && (threads = jobs_cpu_count()) > 1)
+			status = run_soft(threads, vertices, &texture, image);
+	}
+	free(vertices);
+	free(image);
+	return status;
+}
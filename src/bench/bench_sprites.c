@@ -0,0 +1,198 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "gl_util.h"
+#include "sprites.h"
+#include "bench/bench.h"
+
+#define SPRITE_FRAMES	10
+#define SPRITE_TEXTURES	4
+#define SPRITE_SIZE		4	//!< The size of the benchmark sprites, in pixels: small, so as to measure throughput rather than fill rate
+#define SPRITE_BATCH	262144
+
+//! A second program, so that the batch is sorted by program as well as by texture
+static char const* const	grayscale_fragment_shader =
+	"#version 330 core\n"
+	"uniform sampler2D u_texture;\n"
+	"in vec2 v_uv;\n"
+	"in vec4 v_color;\n"
+	"out vec4 f_color;\n"
+	"void main()\n"
+	"{\n"
+	"	vec4 color = texture(u_texture, v_uv) * v_color;\n"
+	"	f_color = vec4(vec3(dot(color.rgb, vec3(0.299, 0.587, 0.114))), color.a);\n"
+	"}\n";
+
+//! A sprite and what to draw it with, generated once so that only the batch itself is measured
+typedef struct sprite_job
+{
+	s_sprite	sprite;
+	GLuint		program;
+	GLuint		texture;
+}	s_sprite_job;
+
+static uint32_t	next_random(uint32_t* state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+static void	generate(s_sprite_job* jobs, size_t count, int width, int height,
+	GLuint const programs[2], GLuint const textures[SPRITE_TEXTURES])
+{
+	uint32_t random = 0x12345678u;
+	uint32_t r;
+	size_t i;
+
+	for (i = 0; i < count; ++i)
+	{
+		r = next_random(&random);
+		jobs[i].program = programs[r & 1];
+		jobs[i].texture = textures[(r >> 1) % SPRITE_TEXTURES];
+		jobs[i].sprite.x = (float)(next_random(&random) % (uint32_t)(width - SPRITE_SIZE));
+		jobs[i].sprite.y = (float)(next_random(&random) % (uint32_t)(height - SPRITE_SIZE));
+		jobs[i].sprite.width = SPRITE_SIZE;
+		jobs[i].sprite.height = SPRITE_SIZE;
+		jobs[i].sprite.angle = (float)(next_random(&random) % 628) / 100.f;
+		jobs[i].sprite.uv[0] = 0;
+		jobs[i].sprite.uv[1] = 0;
+		jobs[i].sprite.uv[2] = 65535;
+		jobs[i].sprite.uv[3] = 65535;
+		r = next_random(&random);
+		jobs[i].sprite.color[0] = (uint8_t)(r);
+		jobs[i].sprite.color[1] = (uint8_t)(r >> 8);
+		jobs[i].sprite.color[2] = (uint8_t)(r >> 16);
+		jobs[i].sprite.color[3] = 255;
+	}
+}
+
+//! Creates small checkerboard textures, each with its own color
+static void	create_textures(GLuint textures[SPRITE_TEXTURES])
+{
+	uint8_t pixels[8 * 8 * 4];
+	int i, p;
+
+	for (i = 0; i < SPRITE_TEXTURES; ++i)
+	{
+		for (p = 0; p < 8 * 8; ++p)
+		{
+			uint8_t on = (uint8_t)((((p & 7) ^ (p >> 3)) & 1) ? 255 : 64);
+			pixels[p * 4 + 0] = (uint8_t)(i & 1 ? on : 0);
+			pixels[p * 4 + 1] = (uint8_t)(i & 2 ? on : 0);
+			pixels[p * 4 + 2] = on;
+			pixels[p * 4 + 3] = 255;
+		}
+		textures[i] = gl_create_texture_rgba8(8, 8, pixels);
+	}
+}
+
+//! Draws `count` sprites per frame, returns nonzero on failure
+static int	run(s_window* window, s_sprites* sprites, s_sprite_job const* jobs, size_t count)
+{
+	static double samples[3][SPRITE_FRAMES];
+	char label[64];
+	double start, queued, submitted;
+	double flushed, flush_start;
+	s_sprite* sprite;
+	int width, height;
+	int frame;
+	size_t i;
+
+	window_framebuffer_size(window, &width, &height);
+	/* one more frame than measured, to warm up the driver and grow the buffers */
+	for (frame = -1; frame < SPRITE_FRAMES; ++frame)
+	{
+		start = bench_time();
+		glClear(GL_COLOR_BUFFER_BIT);
+		sprites_begin(sprites, width, height);
+		flushed = 0.;
+		for (i = 0; i < count; ++i)
+		{
+			/* past a full batch, the add sorts and draws it first: that time is counted as such, not as queueing */
+			if (sprites->count == sprites->batch)
+			{
+				flush_start = bench_time();
+				sprites_flush(sprites);
+				flushed += bench_time() - flush_start;
+			}
+			if (!(sprite = sprites_add(sprites, jobs[i].program, jobs[i].texture)))
+				return -1;
+			*sprite = jobs[i].sprite;
+		}
+		queued = bench_time();
+		sprites_end(sprites);
+		submitted = bench_time();
+		window_swap_buffers(window);
+		glFinish();
+		if (frame >= 0)
+		{
+			samples[0][frame] = queued - start - flushed;
+			samples[1][frame] = submitted - queued + flushed;
+			samples[2][frame] = bench_time() - start;
+		}
+	}
+	snprintf(label, sizeof(label), "%zu sprites: queue", count);
+	bench_report(label, samples[0], SPRITE_FRAMES);
+	snprintf(label, sizeof(label), "%zu sprites: sort + draw", count);
+	bench_report(label, samples[1], SPRITE_FRAMES);
+	snprintf(label, sizeof(label), "%zu sprites: frame", count);
+	bench_report(label, samples[2], SPRITE_FRAMES);
+	printf("%-32s %.2f M sprites/s | %ld draw calls/frame\n", "",
+		(double)count / samples[2][SPRITE_FRAMES / 2] / 1000., sprites->draw_calls);
+	return 0;
+}
+
+int	bench_sprites(s_config const* config)
+{
+	static size_t const counts[] = { 10000, 100000, 1000000 };
+	GLuint textures[SPRITE_TEXTURES];
+	GLuint programs[2];
+	s_sprite_job* jobs;
+	s_sprites sprites;
+	s_window* window;
+	int status = -1;
+	size_t i;
+
+	if (window_init())
+		return -1;
+	window = window_create(config->width, config->height, "bench: sprites", 0);
+	if (!window)
+	{
+		window_terminate();
+		return -1;
+	}
+	window_make_current(window);
+	jobs = (s_sprite_job*)malloc(counts[2] * sizeof(s_sprite_job));
+	if (jobs && window_load_gl(window, 0))
+	{
+		gl_caps_init();
+		gl_state_init();
+		printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+		if (sprites_init(&sprites, SPRITE_BATCH) == 0)
+		{
+			programs[0] = 0;
+			programs[1] = gl_create_program(sprites_vertex_shader, grayscale_fragment_shader);
+			create_textures(textures);
+			generate(jobs, counts[2], config->width, config->height, programs, textures);
+			status = 0;
+			for (i = 0; i < sizeof(counts) / sizeof(counts[0]) && status == 0; ++i)
+				status = run(window, &sprites, jobs, counts[i]);
+			gl_state_delete_textures(SPRITE_TEXTURES, textures);
+			glDeleteProgram(programs[1]);
+			sprites_free(&sprites);
+		}
+	}
+	free(jobs);
+	window_destroy(window);
+	gladUnloadGL();
+	window_terminate();
+	return status;
+}
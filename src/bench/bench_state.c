@@ -0,0 +1,167 @@
+
+#include <stdio.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "gl_util.h"
+#include "bench/bench.h"
+
+#define STATE_FRAMES	30
+#define STATE_DRAWS		2000	//!< The amount of draw calls per frame
+#define STATE_TEXTURES	4
+
+//! A tiny triangle, from `gl_VertexID` alone: the benchmark measures the cost of the calls, not of drawing
+static char const* const	vertex_shader =
+	"#version 330 core\n"
+	"out vec2 v_uv;\n"
+	"void main()\n"
+	"{\n"
+	"	v_uv = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+	"	gl_Position = vec4(v_uv * 0.01 - 1., 0., 1.);\n"
+	"}\n";
+
+static char const* const	fragment_shader =
+	"#version 330 core\n"
+	"uniform sampler2D u_color;\n"
+	"uniform sampler2D u_detail;\n"
+	"in vec2 v_uv;\n"
+	"out vec4 f_color;\n"
+	"void main()\n"
+	"{\n"
+	"	f_color = texture(u_color, v_uv) * texture(u_detail, v_uv);\n"
+	"}\n";
+
+//! The objects which each draw call binds
+typedef struct state_scene
+{
+	GLuint	program;
+	GLuint	vertex_array;
+	GLuint	textures[STATE_TEXTURES];
+	int		width;
+	int		height;
+}	s_state_scene;
+
+/*
+**	Each draw sets all of the state it depends on, as independent pieces of a
+**	renderer do: most of it is the same as for the draw before.
+*/
+
+static void	draw_direct(s_state_scene const* scene, int i)
+{
+	glViewport(0, 0, scene->width, scene->height);
+	glUseProgram(scene->program);
+	glBindVertexArray(scene->vertex_array);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, scene->textures[(i / 64) % STATE_TEXTURES]);
+	glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, scene->textures[0]);
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	glDisable(GL_DEPTH_TEST);
+	glDisable(GL_CULL_FACE);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+static void	draw_tracked(s_state_scene const* scene, int i)
+{
+	gl_state_viewport(0, 0, scene->width, scene->height);
+	gl_state_use_program(scene->program);
+	gl_state_bind_vertex_array(scene->vertex_array);
+	gl_state_bind_texture(0, GL_TEXTURE_2D, scene->textures[(i / 64) % STATE_TEXTURES]);
+	gl_state_bind_texture(1, GL_TEXTURE_2D, scene->textures[0]);
+	gl_state_enable(GL_BLEND, 1);
+	gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	gl_state_enable(GL_DEPTH_TEST, 0);
+	gl_state_enable(GL_CULL_FACE, 0);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+static void	run(s_window* window, s_state_scene const* scene, int tracked)
+{
+	static double samples[2][STATE_FRAMES];
+	double start, submitted;
+	long calls = gl_state.calls;
+	long filtered = gl_state.filtered;
+	int frame, i;
+
+	/* one more frame than measured, to warm up the driver */
+	for (frame = -1; frame < STATE_FRAMES; ++frame)
+	{
+		start = bench_time();
+		glClear(GL_COLOR_BUFFER_BIT);
+		for (i = 0; i < STATE_DRAWS; ++i)
+		{
+			if (tracked)
+				draw_tracked(scene, i);
+			else
+				draw_direct(scene, i);
+		}
+		submitted = bench_time();
+		window_swap_buffers(window);
+		glFinish();
+		if (frame >= 0)
+		{
+			samples[0][frame] = submitted - start;
+			samples[1][frame] = bench_time() - start;
+		}
+	}
+	/* the direct calls changed the state behind the tracker's back */
+	if (!tracked)
+		gl_state_invalidate();
+	bench_report(tracked ? "gl_state: submit (CPU)" : "direct: submit (CPU)", samples[0], STATE_FRAMES);
+	bench_report(tracked ? "gl_state: frame" : "direct: frame", samples[1], STATE_FRAMES);
+	if (tracked)
+		printf("%-32s %ld state changes/frame, %ld redundant ones dropped\n", "",
+			(gl_state.calls - calls) / (STATE_FRAMES + 1),
+			(gl_state.filtered - filtered) / (STATE_FRAMES + 1));
+}
+
+int	bench_state(s_config const* config)
+{
+	static GLubyte const white[4] = { 255, 255, 255, 255 };
+	s_state_scene scene;
+	s_window* window;
+	int status = -1;
+	int i;
+
+	(void)config;
+	if (window_init())
+		return -1;
+	window = window_create(256, 256, "bench: state", 0);
+	if (!window)
+	{
+		window_terminate();
+		return -1;
+	}
+	window_make_current(window);
+	if (window_load_gl(window, 0))
+	{
+		gl_caps_init();
+		gl_state_init();
+		printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+		scene.program = gl_create_program(vertex_shader, fragment_shader);
+		if (scene.program)
+		{
+			window_framebuffer_size(window, &scene.width, &scene.height);
+			glGenVertexArrays(1, &scene.vertex_array);
+			for (i = 0; i < STATE_TEXTURES; ++i)
+				scene.textures[i] = gl_create_texture_rgba8(1, 1, white);
+			gl_state_use_program(scene.program);
+			glUniform1i(glGetUniformLocation(scene.program, "u_color"), 0);
+			glUniform1i(glGetUniformLocation(scene.program, "u_detail"), 1);
+			run(window, &scene, 0);
+			run(window, &scene, 1);
+			gl_state_delete_textures(STATE_TEXTURES, scene.textures);
+			gl_state_delete_vertex_arrays(1, &scene.vertex_array);
+			glDeleteProgram(scene.program);
+			status = 0;
+		}
+	}
+	window_destroy(window);
+	gladUnloadGL();
+	window_terminate();
+	return status;
+}
@@ -0,0 +1,187 @@
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "gl_util.h"
+#include "image_png.h"
+#include "texture_file.h"
+#include "bench/bench.h"
+
+#define TEXTURES_SIZE	2048	//!< The width and height of the texture
+#define TEXTURES_RUNS	5
+
+static char const* const	png_path = "bench-texture.png";
+
+//! The formats which the texture is converted to, and loaded from
+static e_texture_format const	formats[] =
+{
+	TEXTURE_FORMAT_RGBA8,
+	TEXTURE_FORMAT_BC1,
+	TEXTURE_FORMAT_BC3,
+	TEXTURE_FORMAT_BC7,
+};
+#define FORMATS	(sizeof(formats) / sizeof(formats[0]))
+
+//! Makes up an image which compresses like a photo would: smooth gradients, with some noise
+static uint8_t*	make_image(void)
+{
+	uint8_t* pixels = (uint8_t*)malloc((size_t)TEXTURES_SIZE * TEXTURES_SIZE * 4);
+	uint32_t seed = 1;
+	int x, y, c;
+
+	if (!pixels)
+		return NULL;
+	for (y = 0; y < TEXTURES_SIZE; ++y)
+	{
+		for (x = 0; x < TEXTURES_SIZE; ++x)
+		{
+			for (c = 0; c < 4; ++c)
+			{
+				seed = seed * 1664525u + 1013904223u;
+				pixels[((size_t)y * TEXTURES_SIZE + (size_t)x) * 4 + (size_t)c] = (uint8_t)(c == 3 ? 255 :
+					((x * (c + 1) + y * (3 - c)) / 16 + (int)(seed >> 29)) & 0xFF);
+			}
+		}
+	}
+	return pixels;
+}
+
+//! Returns the size of a file, in bytes (`0` if it can't be opened)
+static long	file_size(char const* path)
+{
+	FILE* file = fopen(path, "rb");
+	long size;
+
+	if (!file)
+		return 0;
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fclose(file);
+	return size;
+}
+
+//! Times loading the texture from the PNG file: decoding it, uploading it, and building its mip chain on the GPU
+static int	run_png(void)
+{
+	static double samples[TEXTURES_RUNS];
+	uint8_t* pixels;
+	GLuint texture;
+	double start;
+	int width, height;
+	int run;
+
+	for (run = -1; run < TEXTURES_RUNS; ++run)
+	{
+		start = bench_time();
+		if (!(pixels = image_png_load(png_path, &width, &height)))
+			return -1;
+		texture = gl_create_texture_rgba8(width, height, pixels);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 1000);
+		glGenerateMipmap(GL_TEXTURE_2D);
+		glFinish();
+		free(pixels);
+		if (run >= 0)
+			samples[run] = bench_time() - start;
+		gl_state_delete_textures(1, &texture);
+	}
+	printf("%-32s %ld bytes\n", "png", file_size(png_path));
+	bench_report("png (decode, upload, mipmaps)", samples, TEXTURES_RUNS);
+	return 0;
+}
+
+//! Times loading the texture from a texture file: mapping it, and handing its levels to GL
+static int	run_file(char const* path, e_texture_format format)
+{
+	static double samples[TEXTURES_RUNS];
+	s_texture_file file;
+	char label[64];
+	GLuint texture;
+	double start;
+	int run;
+
+	for (run = -1; run < TEXTURES_RUNS; ++run)
+	{
+		start = bench_time();
+		if (texture_file_map(&file, path))
+			return -1;
+		texture = gl_create_texture_file(&file);
+		glFinish();
+		texture_file_unmap(&file);
+		if (!texture)
+			return -1;
+		if (run >= 0)
+			samples[run] = bench_time() - start;
+		gl_state_delete_textures(1, &texture);
+	}
+	snprintf(label, sizeof(label), "texture file, %s", texture_format_info(format)->name);
+	printf("%-32s %ld bytes\n", label, file_size(path));
+	snprintf(label, sizeof(label), "%s (map, upload)", texture_format_info(format)->name);
+	bench_report(label, samples, TEXTURES_RUNS);
+	return 0;
+}
+
+//! Writes the PNG file and the texture files, then times loading each of them
+static int	run_all(uint8_t const* pixels)
+{
+	char paths[FORMATS][64];
+	double start;
+	int status;
+	size_t i;
+
+	if (image_png_save(png_path, pixels, TEXTURES_SIZE, TEXTURES_SIZE))
+		return -1;
+	status = run_png();
+	for (i = 0; i < FORMATS && status == 0; ++i)
+	{
+		snprintf(paths[i], sizeof(paths[i]), "bench-texture-%s.gtex", texture_format_info(formats[i])->name);
+		/* this is the offline conversion: it is only timed for reference */
+		start = bench_time();
+		status = texture_file_write(paths[i], formats[i], pixels, TEXTURES_SIZE, TEXTURES_SIZE, 1);
+		printf("%-32s converted in %.3f ms\n", paths[i], bench_time() - start);
+		if (status == 0)
+			status = run_file(paths[i], formats[i]);
+		remove(paths[i]);
+	}
+	remove(png_path);
+	return status;
+}
+
+int	bench_textures(s_config const* config)
+{
+	s_window* window;
+	uint8_t* pixels;
+	int status = -1;
+
+	(void)config;
+	if (!(pixels = make_image()))
+		return -1;
+	if (window_init())
+	{
+		free(pixels);
+		return -1;
+	}
+	window = window_create(64, 64, "bench: textures", 0);
+	if (window)
+	{
+		window_make_current(window);
+		if (window_load_gl(window, 0))
+		{
+			gl_caps_init();
+			gl_state_init();
+			printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+			printf("a %dx%d texture with its mip chain, loaded %d times\n", TEXTURES_SIZE, TEXTURES_SIZE, TEXTURES_RUNS);
+			status = run_all(pixels);
+		}
+		window_destroy(window);
+		gladUnloadGL();
+	}
+	window_terminate();
+	free(pixels);
+	return status;
+}
@@ -0,0 +1,218 @@
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "gl_util.h"
+#include "mat4.h"
+#include "uniforms.h"
+#include "bench/bench.h"
+
+#define UNIFORM_FRAMES	20
+#define UNIFORM_OBJECTS	10000
+
+//! The same shader, with plain uniforms or with uniform blocks
+static char const* const	plain_vertex_shader =
+	"#version 330 core\n"
+	"uniform mat4 u_view_projection;\n"
+	"uniform mat4 u_model;\n"
+	"uniform vec4 u_color;\n"
+	"out vec4 v_color;\n"
+	"void main()\n"
+	"{\n"
+	"	vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+	"	gl_Position = u_view_projection * u_model * vec4(corner, 0., 1.);\n"
+	"	v_color = u_color;\n"
+	"}\n";
+
+static char const* const	block_vertex_shader =
+	"#version 330 core\n"
+	UNIFORM_GLSL(FRAME)
+	UNIFORM_GLSL(OBJECT)
+	"out vec4 v_color;\n"
+	"void main()\n"
+	"{\n"
+	"	vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+	"	gl_Position = view_projection * model * vec4(corner, 0., 1.);\n"
+	"	v_color = color;\n"
+	"}\n";
+
+static char const* const	fragment_shader =
+	"#version 330 core\n"
+	"in vec4 v_color;\n"
+	"out vec4 f_color;\n"
+	"void main()\n"
+	"{\n"
+	"	f_color = v_color;\n"
+	"}\n";
+
+//! Gives the model matrix and color of an object: a tiny triangle, somewhere on screen
+static void	object(int i, float time, float model[16], float color[4])
+{
+	float scale = 0.01f;
+
+	memset(model, 0, sizeof(float[16]));
+	model[10] = 1.f;
+	model[15] = 1.f;
+	model[0] = scale * cosf(time + (float)i);
+	model[1] = scale * sinf(time + (float)i);
+	model[4] = -model[1];
+	model[5] = model[0];
+	model[12] = (float)(i % 100) / 50.f - 1.f;
+	model[13] = (float)(i / 100) / 50.f - 1.f;
+	color[0] = (float)(i % 7) / 6.f;
+	color[1] = (float)(i % 11) / 10.f;
+	color[2] = (float)(i % 13) / 12.f;
+	color[3] = 1.f;
+}
+
+static void	draw_plain(GLuint program, float time)
+{
+	GLint model_location = glGetUniformLocation(program, "u_model");
+	GLint color_location = glGetUniformLocation(program, "u_color");
+	float model[16];
+	float color[4];
+	int i;
+
+	for (i = 0; i < UNIFORM_OBJECTS; ++i)
+	{
+		object(i, time, model, color);
+		glUniformMatrix4fv(model_location, 1, GL_FALSE, model);
+		glUniform4fv(color_location, 1, color);
+		glDrawArrays(GL_TRIANGLE_STRIP, 0, 3);
+	}
+}
+
+static int	draw_blocks(s_uniforms* uniforms, float time)
+{
+	static GLintptr offsets[UNIFORM_OBJECTS];
+	s_uniform_frame* frame;
+	s_uniform_object* block;
+	GLintptr frame_offset;
+	s_mat4 identity;
+	int i;
+
+	if (uniforms_begin(uniforms))
+		return -1;
+	/* all of the frame's blocks are written first, and uploaded at once */
+	if (!(frame = (s_uniform_frame*)uniforms_push(uniforms, UNIFORM_FRAME, &frame_offset)))
+		return -1;
+	mat4_identity(&identity);
+	memcpy(frame->view_projection.m, identity.m, sizeof(identity.m));
+	frame->time = time;
+	for (i = 0; i < UNIFORM_OBJECTS; ++i)
+	{
+		if (!(block = (s_uniform_object*)uniforms_push(uniforms, UNIFORM_OBJECT, &offsets[i])))
+			return -1;
+		object(i, time, block->model.m, block->color.v);
+	}
+	uniforms_upload(uniforms);
+	uniforms_bind(uniforms, UNIFORM_FRAME, frame_offset);
+	for (i = 0; i < UNIFORM_OBJECTS; ++i)
+	{
+		uniforms_bind(uniforms, UNIFORM_OBJECT, offsets[i]);
+		glDrawArrays(GL_TRIANGLE_STRIP, 0, 3);
+	}
+	uniforms_end(uniforms);
+	return 0;
+}
+
+static int	run(s_window* window, GLuint program, s_uniforms* uniforms)
+{
+	static double samples[2][UNIFORM_FRAMES];
+	char const* name = (uniforms ? "uniform blocks" : "glUniform*");
+	char label[64];
+	double start, submitted;
+	s_mat4 identity;
+	int frame;
+
+	gl_state_use_program(program);
+	if (!uniforms)
+	{
+		mat4_identity(&identity);
+		glUniformMatrix4fv(glGetUniformLocation(program, "u_view_projection"), 1, GL_FALSE, identity.m);
+	}
+	/* one more frame than measured, to warm up the driver */
+	for (frame = -1; frame < UNIFORM_FRAMES; ++frame)
+	{
+		start = bench_time();
+		glClear(GL_COLOR_BUFFER_BIT);
+		if (!uniforms)
+			draw_plain(program, (float)frame * 0.1f);
+		else if (draw_blocks(uniforms, (float)frame * 0.1f))
+		{
+			fprintf(stderr, "error: the uniform buffer is too small\n");
+			return -1;
+		}
+		submitted = bench_time();
+		window_swap_buffers(window);
+		glFinish();
+		if (frame >= 0)
+		{
+			samples[0][frame] = submitted - start;
+			samples[1][frame] = bench_time() - start;
+		}
+	}
+	snprintf(label, sizeof(label), "%s: submit (CPU)", name);
+	bench_report(label, samples[0], UNIFORM_FRAMES);
+	snprintf(label, sizeof(label), "%s: frame", name);
+	bench_report(label, samples[1], UNIFORM_FRAMES);
+	/* the samples are sorted by now */
+	printf("%-32s %d objects | submit: %.3f us/object\n", "", UNIFORM_OBJECTS,
+		samples[0][UNIFORM_FRAMES / 2] * 1000. / UNIFORM_OBJECTS);
+	return 0;
+}
+
+int	bench_uniforms(s_config const* config)
+{
+	s_uniforms uniforms;
+	s_window* window;
+	GLuint programs[2] = { 0, 0 };
+	GLuint vertex_array;
+	int status = -1;
+
+	if (window_init())
+		return -1;
+	window = window_create(config->width, config->height, "bench: uniforms", 0);
+	if (!window)
+	{
+		window_terminate();
+		return -1;
+	}
+	window_make_current(window);
+	if (window_load_gl(window, 0))
+	{
+		gl_caps_init();
+		gl_state_init();
+		printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+		printf("uniform buffer offset alignment: %d bytes\n", gl_caps.uniform_buffer_offset_alignment);
+		programs[0] = gl_create_program(plain_vertex_shader, fragment_shader);
+		programs[1] = gl_create_program(block_vertex_shader, fragment_shader);
+		if (programs[0] && programs[1] && uniforms_bind_blocks(programs[1]) == 0 &&
+			uniforms_init(&uniforms, (UNIFORM_OBJECTS + 1) * (sizeof(s_uniform_object) +
+				(size_t)gl_caps.uniform_buffer_offset_alignment)) == 0)
+		{
+			/* the corners come from gl_VertexID: the vertex array has no attributes */
+			glGenVertexArrays(1, &vertex_array);
+			gl_state_bind_vertex_array(vertex_array);
+			status = run(window, programs[0], NULL);
+			if (status == 0)
+				status = run(window, programs[1], &uniforms);
+			gl_state_delete_vertex_arrays(1, &vertex_array);
+			uniforms_free(&uniforms);
+		}
+		if (programs[0])
+			glDeleteProgram(programs[0]);
+		if (programs[1])
+			glDeleteProgram(programs[1]);
+	}
+	window_destroy(window);
+	gladUnloadGL();
+	window_terminate();
+	return status;
+}
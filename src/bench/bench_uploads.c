@@ -0,0 +1,166 @@
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "gl_util.h"
+#include "framepacer.h"
+#include "uploader.h"
+#include "bench/bench.h"
+
+#define UPLOADS_FRAMES		120	//!< The amount of frames rendered, at 60 per second
+#define UPLOADS_LOAD_FRAME	20		//!< The frame at which the assets start loading
+#define UPLOADS_TEXTURES	8
+#define UPLOADS_SIZE		2048	//!< The width and height of each texture (16 MiB of RGBA each)
+
+static char const* const	vertex_shader =
+	"#version 330 core\n"
+	"out vec2 v_uv;\n"
+	"void main()\n"
+	"{\n"
+	"	v_uv = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+	"	gl_Position = vec4(v_uv * 2. - 1., 0., 1.);\n"
+	"}\n";
+
+static char const* const	fragment_shader =
+	"#version 330 core\n"
+	"uniform sampler2D u_texture;\n"
+	"in vec2 v_uv;\n"
+	"out vec4 f_color;\n"
+	"void main()\n"
+	"{\n"
+	"	f_color = texture(u_texture, v_uv);\n"
+	"}\n";
+
+//! Renders frames, drawing the last texture which finished loading, while the textures load mid-way
+/*!
+**	The frames are capped to 60 per second, as they would be with vsync: only the work of each frame is timed.
+**	@param uploader	The uploader to load the textures with, or `NULL` to create them on the render thread
+*/
+static int	run(s_window* window, s_uploader* uploader, uint8_t* const* pixels, char const* label)
+{
+	static double samples[UPLOADS_FRAMES];
+	GLuint textures[UPLOADS_TEXTURES] = { 0 };
+	s_framepacer pacer;
+	s_upload upload;
+	double start, load_start = 0.;
+	double loaded = -1.;
+	int arrived = 0;
+	int frame, i;
+
+	framepacer_init(&pacer, window, PACING_CAPPED, 60., 0);
+	for (frame = 0; frame < UPLOADS_FRAMES; ++frame)
+	{
+		framepacer_wait(&pacer);
+		framepacer_work_begin(&pacer);
+		start = bench_time();
+		if (frame == UPLOADS_LOAD_FRAME)
+		{
+			load_start = start;
+			for (i = 0; i < UPLOADS_TEXTURES; ++i)
+			{
+				if (!uploader)
+				{
+					textures[arrived++] = gl_create_texture_rgba8(UPLOADS_SIZE, UPLOADS_SIZE, pixels[i]);
+					continue;
+				}
+				upload.kind = UPLOAD_TEXTURE;
+				upload.data = pixels[i];
+				upload.width = UPLOADS_SIZE;
+				upload.height = UPLOADS_SIZE;
+				upload.user = NULL;
+				if (uploader_submit(uploader, &upload))
+					return -1;
+			}
+		}
+		while (uploader && uploader_poll(uploader, &upload))
+			textures[arrived++] = upload.object;
+		if (arrived == UPLOADS_TEXTURES && loaded < 0.)
+			loaded = bench_time() - load_start;
+		glClear(GL_COLOR_BUFFER_BIT);
+		if (arrived)
+		{
+			gl_state_bind_texture(0, GL_TEXTURE_2D, textures[arrived - 1]);
+			glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+		}
+		/* the GPU side of the uploads counts too */
+		glFinish();
+		samples[frame] = bench_time() - start;
+		window_swap_buffers(window);
+		framepacer_presented(&pacer);
+	}
+	gl_state_delete_textures(arrived, textures);
+	bench_report(label, samples, UPLOADS_FRAMES);
+	if (loaded < 0.)
+	{
+		fprintf(stderr, "error: only %d of the %d textures were loaded after %d frames\n",
+			arrived, UPLOADS_TEXTURES, UPLOADS_FRAMES - UPLOADS_LOAD_FRAME);
+		return -1;
+	}
+	printf("%-32s all %d loaded after %.3f ms\n", "", UPLOADS_TEXTURES, loaded);
+	return 0;
+}
+
+int	bench_uploads(s_config const* config)
+{
+	static uint8_t* pixels[UPLOADS_TEXTURES];
+	size_t const size = (size_t)UPLOADS_SIZE * UPLOADS_SIZE * 4;
+	s_uploader uploader;
+	s_window* window;
+	GLuint vertex_array;
+	GLuint program = 0;
+	int status = -1;
+	size_t j;
+	int i;
+
+	(void)config;
+	for (i = 0; i < UPLOADS_TEXTURES; ++i)
+	{
+		if (!(pixels[i] = (uint8_t*)malloc(size)))
+			break;
+		for (j = 0; j < size; ++j)
+			pixels[i][j] = (uint8_t)(j * (size_t)(i + 1) >> 4);
+	}
+	if (i == UPLOADS_TEXTURES && window_init() == 0)
+	{
+		window = window_create(256, 256, "bench: uploads", 0);
+		if (window)
+		{
+			window_make_current(window);
+			if (window_load_gl(window, 0))
+			{
+				gl_caps_init();
+				gl_state_init();
+				program = gl_create_program(vertex_shader, fragment_shader);
+			}
+			if (program)
+			{
+				printf("GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+				printf("%d textures of %dx%d, loaded at frame %d\n",
+					UPLOADS_TEXTURES, UPLOADS_SIZE, UPLOADS_SIZE, UPLOADS_LOAD_FRAME);
+				glGenVertexArrays(1, &vertex_array);
+				gl_state_bind_vertex_array(vertex_array);
+				gl_state_use_program(program);
+				status = run(window, NULL, pixels, "render thread: frame");
+				if (status == 0 && (status = uploader_init(&uploader, window)) == 0)
+				{
+					status = run(window, &uploader, pixels, "upload thread: frame");
+					uploader_free(&uploader);
+				}
+				gl_state_delete_vertex_arrays(1, &vertex_array);
+				glDeleteProgram(program);
+			}
+			window_destroy(window);
+			gladUnloadGL();
+		}
+		window_terminate();
+	}
+	while (i-- > 0)
+		free(pixels[i]);
+	return status;
+}
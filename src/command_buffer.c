@@ -0,0 +1,272 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "command_buffer.h"
+#include "gl_state.h"
+
+//! The header of a command: the command in the low byte, and the amount of words of its arguments above it
+#define HEADER(command, words)	((uint32_t)(command) | (uint32_t)(words) << 8)
+
+int		command_buffer_init(s_command_buffer* buffer, size_t size)
+{
+	memset(buffer, 0, sizeof(s_command_buffer));
+	buffer->capacity = size / sizeof(uint32_t);
+	if (!(buffer->words = (uint32_t*)malloc(buffer->capacity * sizeof(uint32_t))))
+	{
+		fprintf(stderr, "error: could not allocate a command buffer of %zu bytes\n", size);
+		return -1;
+	}
+	return 0;
+}
+
+void	command_buffer_free(s_command_buffer* buffer)
+{
+	free(buffer->words);
+	memset(buffer, 0, sizeof(s_command_buffer));
+}
+
+void	command_buffer_reset(s_command_buffer* buffer)
+{
+	buffer->count = 0;
+	buffer->commands = 0;
+	buffer->overflow = 0;
+}
+
+//! Appends the header of a command, and returns where its arguments go (`NULL` if it does not fit)
+static uint32_t*	record(s_command_buffer* buffer, e_command command, size_t words)
+{
+	uint32_t* header;
+
+	if (buffer->count + 1 + words > buffer->capacity)
+	{
+		buffer->overflow = 1;
+		return NULL;
+	}
+	header = &buffer->words[buffer->count];
+	*header = HEADER(command, words);
+	buffer->count += 1 + words;
+	++buffer->commands;
+	return header + 1;
+}
+
+//! Records a command whose arguments are all 32-bit integers
+static void	record_words(s_command_buffer* buffer, e_command command, size_t count, uint32_t const* arguments)
+{
+	uint32_t* words = record(buffer, command, count);
+
+	if (words)
+		memcpy(words, arguments, count * sizeof(uint32_t));
+}
+
+void	command_viewport(s_command_buffer* buffer, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	uint32_t const arguments[4] = { (uint32_t)x, (uint32_t)y, (uint32_t)width, (uint32_t)height };
+
+	record_words(buffer, COMMAND_VIEWPORT, 4, arguments);
+}
+
+void	command_scissor(s_command_buffer* buffer, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	uint32_t const arguments[4] = { (uint32_t)x, (uint32_t)y, (uint32_t)width, (uint32_t)height };
+
+	record_words(buffer, COMMAND_SCISSOR, 4, arguments);
+}
+
+void	command_use_program(s_command_buffer* buffer, GLuint program)
+{
+	record_words(buffer, COMMAND_USE_PROGRAM, 1, &program);
+}
+
+void	command_bind_vertex_array(s_command_buffer* buffer, GLuint vertex_array)
+{
+	record_words(buffer, COMMAND_BIND_VERTEX_ARRAY, 1, &vertex_array);
+}
+
+void	command_bind_buffer(s_command_buffer* buffer, GLenum target, GLuint name)
+{
+	uint32_t const arguments[2] = { target, name };
+
+	record_words(buffer, COMMAND_BIND_BUFFER, 2, arguments);
+}
+
+void	command_bind_buffer_range(s_command_buffer* buffer, GLenum target, GLuint index, GLuint name,
+	GLintptr offset, GLsizeiptr size)
+{
+	uint32_t const arguments[5] = { target, index, name, (uint32_t)offset, (uint32_t)size };
+
+	record_words(buffer, COMMAND_BIND_BUFFER_RANGE, 5, arguments);
+}
+
+void	command_bind_texture(s_command_buffer* buffer, GLuint unit, GLenum target, GLuint texture)
+{
+	uint32_t const arguments[3] = { unit, target, texture };
+
+	record_words(buffer, COMMAND_BIND_TEXTURE, 3, arguments);
+}
+
+void	command_enable(s_command_buffer* buffer, GLenum capability, int enable)
+{
+	uint32_t const arguments[2] = { capability, (uint32_t)(enable != 0) };
+
+	record_words(buffer, COMMAND_ENABLE, 2, arguments);
+}
+
+void	command_blend_func(s_command_buffer* buffer, GLenum source, GLenum destination)
+{
+	uint32_t const arguments[2] = { source, destination };
+
+	record_words(buffer, COMMAND_BLEND_FUNC, 2, arguments);
+}
+
+void	command_uniform_1i(s_command_buffer* buffer, GLint location, GLint value)
+{
+	uint32_t const arguments[2] = { (uint32_t)location, (uint32_t)value };
+
+	record_words(buffer, COMMAND_UNIFORM_1I, 2, arguments);
+}
+
+void	command_uniform_4f(s_command_buffer* buffer, GLint location, float const value[4])
+{
+	uint32_t* words = record(buffer, COMMAND_UNIFORM_4F, 5);
+
+	if (!words)
+		return;
+	words[0] = (uint32_t)location;
+	memcpy(&words[1], value, sizeof(float[4]));
+}
+
+void	command_uniform_matrix4(s_command_buffer* buffer, GLint location, float const value[16])
+{
+	uint32_t* words = record(buffer, COMMAND_UNIFORM_MATRIX4, 17);
+
+	if (!words)
+		return;
+	words[0] = (uint32_t)location;
+	memcpy(&words[1], value, sizeof(float[16]));
+}
+
+void	command_draw_arrays(s_command_buffer* buffer, GLenum mode, GLint first, GLsizei count)
+{
+	uint32_t const arguments[3] = { mode, (uint32_t)first, (uint32_t)count };
+
+	record_words(buffer, COMMAND_DRAW_ARRAYS, 3, arguments);
+}
+
+void	command_draw_arrays_instanced(s_command_buffer* buffer, GLenum mode, GLint first, GLsizei count,
+	GLsizei instances)
+{
+	uint32_t const arguments[4] = { mode, (uint32_t)first, (uint32_t)count, (uint32_t)instances };
+
+	record_words(buffer, COMMAND_DRAW_ARRAYS_INSTANCED, 4, arguments);
+}
+
+void	command_draw_elements(s_command_buffer* buffer, GLenum mode, GLsizei count, GLenum type, size_t offset)
+{
+	uint32_t const arguments[4] = { mode, (uint32_t)count, type, (uint32_t)offset };
+
+	record_words(buffer, COMMAND_DRAW_ELEMENTS, 4, arguments);
+}
+
+void	command_draw_elements_instanced(s_command_buffer* buffer, GLenum mode, GLsizei count, GLenum type,
+	size_t offset, GLsizei instances, GLuint base_instance)
+{
+	uint32_t const arguments[6] = { mode, (uint32_t)count, type, (uint32_t)offset, (uint32_t)instances, base_instance };
+
+	record_words(buffer, COMMAND_DRAW_ELEMENTS_INSTANCED, 6, arguments);
+}
+
+//! Makes the GL calls of one command, from its arguments
+static void	replay(e_command command, uint32_t const* words)
+{
+	float values[16];
+
+	switch (command)
+	{
+		case COMMAND_VIEWPORT:
+			gl_state_viewport((GLint)words[0], (GLint)words[1], (GLsizei)words[2], (GLsizei)words[3]);
+			break;
+		case COMMAND_SCISSOR:
+			gl_state_scissor((GLint)words[0], (GLint)words[1], (GLsizei)words[2], (GLsizei)words[3]);
+			break;
+		case COMMAND_USE_PROGRAM:
+			gl_state_use_program(words[0]);
+			break;
+		case COMMAND_BIND_VERTEX_ARRAY:
+			gl_state_bind_vertex_array(words[0]);
+			break;
+		case COMMAND_BIND_BUFFER:
+			gl_state_bind_buffer(words[0], words[1]);
+			break;
+		case COMMAND_BIND_BUFFER_RANGE:
+			gl_state_bind_buffer_range(words[0], words[1], words[2], (GLintptr)words[3], (GLsizeiptr)words[4]);
+			break;
+		case COMMAND_BIND_TEXTURE:
+			gl_state_bind_texture(words[0], words[1], words[2]);
+			break;
+		case COMMAND_ENABLE:
+			gl_state_enable(words[0], (int)words[1]);
+			break;
+		case COMMAND_BLEND_FUNC:
+			gl_state_blend_func(words[0], words[1]);
+			break;
+		case COMMAND_UNIFORM_1I:
+			glUniform1i((GLint)words[0], (GLint)words[1]);
+			break;
+		case COMMAND_UNIFORM_4F:
+			memcpy(values, &words[1], sizeof(float[4]));
+			glUniform4fv((GLint)words[0], 1, values);
+			break;
+		case COMMAND_UNIFORM_MATRIX4:
+			memcpy(values, &words[1], sizeof(float[16]));
+			glUniformMatrix4fv((GLint)words[0], 1, GL_FALSE, values);
+			break;
+		case COMMAND_DRAW_ARRAYS:
+			glDrawArrays(words[0], (GLint)words[1], (GLsizei)words[2]);
+			break;
+		case COMMAND_DRAW_ARRAYS_INSTANCED:
+			glDrawArraysInstanced(words[0], (GLint)words[1], (GLsizei)words[2], (GLsizei)words[3]);
+			break;
+		case COMMAND_DRAW_ELEMENTS:
+			glDrawElements(words[0], (GLsizei)words[1], words[2], (void const*)(uintptr_t)words[3]);
+			break;
+		case COMMAND_DRAW_ELEMENTS_INSTANCED:
+			if (words[5])
+				glDrawElementsInstancedBaseInstance(words[0], (GLsizei)words[1], words[2],
+					(void const*)(uintptr_t)words[3], (GLsizei)words[4], words[5]);
+			else
+				glDrawElementsInstanced(words[0], (GLsizei)words[1], words[2],
+					(void const*)(uintptr_t)words[3], (GLsizei)words[4]);
+			break;
+		default:
+			break;
+	}
+}
+
+int		command_buffer_replay(s_command_buffer const* buffers, size_t count)
+{
+	uint32_t const* words;
+	uint32_t const* end;
+	int status = 0;
+	size_t i;
+
+	for (i = 0; i < count; ++i)
+	{
+		if (buffers[i].overflow)
+		{
+			fprintf(stderr, "error: command buffer %zu overflowed (%zu words), it is skipped\n",
+				i, buffers[i].capacity);
+			status = -1;
+			continue;
+		}
+		words = buffers[i].words;
+		end = words + buffers[i].count;
+		while (words < end)
+		{
+			replay((e_command)(*words & 0xFF), words + 1);
+			words += 1 + (*words >> 8);
+		}
+	}
+	return status;
+}
@@ -0,0 +1,102 @@
+#ifndef COMMAND_BUFFER_H
+#define COMMAND_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <glad/glad.h>
+
+/*
+**	Deferred GL command recording: GL calls may only be made on the thread
+**	which has the context current, but building the draws of a frame (finding
+**	the state, computing matrices) can be shared out between threads. Each
+**	thread records into its own command buffer, which needs no GL and no
+**	lock: commands are packed into 32-bit words (a header, which holds the
+**	command and its size, then its arguments), in memory which is allocated
+**	once, up front. The thread which has the context then replays the
+**	buffers one after the other, in the order given, whichever thread
+**	recorded them: state changes go through `gl_state`, which drops those
+**	which are redundant across buffers, and the rest are plain GL calls.
+**	A buffer which runs out of room drops the commands which do not fit, and
+**	is not replayed at all: its capacity should be sized for the worst frame.
+*/
+
+//! The commands which can be recorded
+typedef enum command
+{
+	COMMAND_VIEWPORT,
+	COMMAND_SCISSOR,
+	COMMAND_USE_PROGRAM,
+	COMMAND_BIND_VERTEX_ARRAY,
+	COMMAND_BIND_BUFFER,
+	COMMAND_BIND_BUFFER_RANGE,
+	COMMAND_BIND_TEXTURE,
+	COMMAND_ENABLE,
+	COMMAND_BLEND_FUNC,
+	COMMAND_UNIFORM_1I,
+	COMMAND_UNIFORM_4F,
+	COMMAND_UNIFORM_MATRIX4,
+	COMMAND_DRAW_ARRAYS,
+	COMMAND_DRAW_ARRAYS_INSTANCED,
+	COMMAND_DRAW_ELEMENTS,
+	COMMAND_DRAW_ELEMENTS_INSTANCED,
+	ENUMLENGTH_COMMAND
+}	e_command;
+
+//! The commands recorded by one thread
+typedef struct command_buffer
+{
+	uint32_t*	words;		//!< The recorded commands
+	size_t		count;		//!< The amount of words in use
+	size_t		capacity;	//!< The amount of words which `words` can hold
+	long		commands;	//!< The amount of commands recorded since the last reset
+	int			overflow;	//!< Nonzero if a command did not fit, since the last reset
+}	s_command_buffer;
+
+//! Allocates the memory of a command buffer, returns `0` on success
+/*!
+**	@param buffer	The command buffer to set up
+**	@param size		The most bytes of commands which it can hold, until it is reset
+*/
+int		command_buffer_init(s_command_buffer* buffer, size_t size);
+void	command_buffer_free(s_command_buffer* buffer);
+//! Empties a command buffer, to record the next frame
+void	command_buffer_reset(s_command_buffer* buffer);
+
+//! Replays command buffers in order, on the thread which has the context current, returns `0` on success
+/*!
+**	@returns
+**	`0` on success, or `-1` if any of the buffers overflowed: those are skipped (with an error message)
+*/
+int		command_buffer_replay(s_command_buffer const* buffers, size_t count);
+
+/*
+**	The commands: each is recorded with the same arguments as the GL call (or
+**	`gl_state` call) which it is replayed as. Offsets into buffers are 32-bit.
+*/
+
+void	command_viewport(s_command_buffer* buffer, GLint x, GLint y, GLsizei width, GLsizei height);
+void	command_scissor(s_command_buffer* buffer, GLint x, GLint y, GLsizei width, GLsizei height);
+void	command_use_program(s_command_buffer* buffer, GLuint program);
+void	command_bind_vertex_array(s_command_buffer* buffer, GLuint vertex_array);
+void	command_bind_buffer(s_command_buffer* buffer, GLenum target, GLuint name);
+void	command_bind_buffer_range(s_command_buffer* buffer, GLenum target, GLuint index, GLuint name,
+			GLintptr offset, GLsizeiptr size);
+void	command_bind_texture(s_command_buffer* buffer, GLuint unit, GLenum target, GLuint texture);
+void	command_enable(s_command_buffer* buffer, GLenum capability, int enable);
+void	command_blend_func(s_command_buffer* buffer, GLenum source, GLenum destination);
+//! Sets a uniform of the program in use, when it is replayed
+void	command_uniform_1i(s_command_buffer* buffer, GLint location, GLint value);
+void	command_uniform_4f(s_command_buffer* buffer, GLint location, float const value[4]);
+//! Sets a column-major `mat4` uniform
+void	command_uniform_matrix4(s_command_buffer* buffer, GLint location, float const value[16]);
+void	command_draw_arrays(s_command_buffer* buffer, GLenum mode, GLint first, GLsizei count);
+void	command_draw_arrays_instanced(s_command_buffer* buffer, GLenum mode, GLint first, GLsizei count,
+			GLsizei instances);
+//! Draws indices from the element array buffer of the bound vertex array, starting `offset` bytes into it
+void	command_draw_elements(s_command_buffer* buffer, GLenum mode, GLsizei count, GLenum type, size_t offset);
+//! Draws instances of indices, with a base instance if it is not 0 (which needs `gl_caps.base_instance`)
+void	command_draw_elements_instanced(s_command_buffer* buffer, GLenum mode, GLsizei count, GLenum type,
+			size_t offset, GLsizei instances, GLuint base_instance);
+
+#endif
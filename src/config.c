@@ -0,0 +1,203 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+
+void	config_usage(char const* program)
+{
+	fprintf(stderr,
+		"usage: %s [options]\n"
+		"  --gl-lazy        resolve GL functions on first call, instead of all at startup\n"
+		"  --gl-info        print the GL driver info and which fast paths are available\n"
+		"  --bench <name>   run the given benchmark (or 'all') and exit\n"
+		"  --size <w>x<h>   size of the window/framebuffer, in pixels (default: 640x480)\n"
+		"  --frames <n>     exit after rendering this many frames (default: 0, never)\n"
+		"  --stats          print a summary of the frame times on exit\n"
+		"  --stats-csv <f>  write the timings of every frame to a CSV file on exit\n"
+		"  --stats-json <f> write the frame time summary and timings to a JSON file on exit\n"
+		"  --overlay        draw a graph of the recent frame times over the frame\n"
+		"  --pacing <mode>  uncapped, vsync (default), adaptive (vsync which tears when late) or capped\n"
+		"  --fps <n>        the frame rate of capped pacing, and of the output (default: 60, implies --pacing capped)\n"
+		"  --low-latency    sample input as late as possible before rendering each frame\n"
+		"  --idle           sleep until input, a resize or the next (once a second) update, instead of redrawing constantly\n"
+		"  --scene <name>   draw the given scene (instances), rather than a blank screen\n"
+		"  --shader-cache <dir>  where the shaders benchmark keeps program binaries (default: shader-cache)\n"
+		"  --output <file>  write the frames to a .yuv, .y4m or .png file (like frame-%%05d.png) instead of showing them\n"
+		"  --encoders <n>   the amount of threads which write the frames out (default: 4)\n"
+		"  --jobs <n>       the amount of threads which run the per-frame jobs, the main one included (default: one per CPU)\n"
+		"  --render-thread  render on a thread of its own, so that events are handled during slow frames (no stats in the title)\n"
+		"  --help           show this message\n",
+		program);
+}
+
+//! Returns the value which follows the option `argv[*i]`, or `NULL` (with an error message) if there is none
+static char const*	option_value(int* i, int argc, char** argv)
+{
+	if (*i + 1 >= argc)
+	{
+		fprintf(stderr, "error: expected a value after '%s'\n", argv[*i]);
+		return NULL;
+	}
+	return argv[++*i];
+}
+
+int	config_parse(s_config* config, int argc, char** argv)
+{
+	char const* value;
+	char* end;
+	int pacing = -1;
+	int i;
+
+	memset(config, 0, sizeof(s_config));
+	config->width = 640;
+	config->height = 480;
+	config->encoders = 4;
+	for (i = 1; i < argc; ++i)
+	{
+		char const* arg = argv[i];
+		if (strcmp(arg, "--gl-lazy") == 0)
+		{
+			config->gl_lazy = 1;
+		}
+		else if (strcmp(arg, "--gl-info") == 0)
+		{
+			config->gl_info = 1;
+		}
+		else if (strcmp(arg, "--bench") == 0)
+		{
+			if (!(config->bench = option_value(&i, argc, argv)))
+				return -1;
+		}
+		else if (strcmp(arg, "--size") == 0)
+		{
+			if (!(value = option_value(&i, argc, argv)))
+				return -1;
+			if (sscanf(value, "%dx%d", &config->width, &config->height) != 2 ||
+				config->width <= 0 || config->height <= 0)
+			{
+				fprintf(stderr, "error: expected a size like '1920x1080' after '%s'\n", arg);
+				return -1;
+			}
+		}
+		else if (strcmp(arg, "--frames") == 0)
+		{
+			if (!(value = option_value(&i, argc, argv)))
+				return -1;
+			config->frames = strtol(value, &end, 10);
+			if (*end != '\0' || config->frames < 0)
+			{
+				fprintf(stderr, "error: expected a positive frame count after '%s'\n", arg);
+				return -1;
+			}
+		}
+		else if (strcmp(arg, "--stats") == 0)
+		{
+			config->stats = 1;
+		}
+		else if (strcmp(arg, "--stats-csv") == 0)
+		{
+			if (!(config->stats_csv = option_value(&i, argc, argv)))
+				return -1;
+		}
+		else if (strcmp(arg, "--stats-json") == 0)
+		{
+			if (!(config->stats_json = option_value(&i, argc, argv)))
+				return -1;
+		}
+		else if (strcmp(arg, "--overlay") == 0)
+		{
+			config->overlay = 1;
+		}
+		else if (strcmp(arg, "--pacing") == 0)
+		{
+			if (!(value = option_value(&i, argc, argv)))
+				return -1;
+			if ((pacing = framepacer_mode(value)) < 0)
+			{
+				fprintf(stderr, "error: unknown pacing mode '%s'\n", value);
+				return -1;
+			}
+		}
+		else if (strcmp(arg, "--fps") == 0)
+		{
+			if (!(value = option_value(&i, argc, argv)))
+				return -1;
+			config->fps = strtod(value, &end);
+			if (*end != '\0' || config->fps <= 0.)
+			{
+				fprintf(stderr, "error: expected a positive frame rate after '%s'\n", arg);
+				return -1;
+			}
+		}
+		else if (strcmp(arg, "--low-latency") == 0)
+		{
+			config->low_latency = 1;
+		}
+		else if (strcmp(arg, "--idle") == 0)
+		{
+			config->idle = 1;
+		}
+		else if (strcmp(arg, "--scene") == 0)
+		{
+			if (!(config->scene = option_value(&i, argc, argv)))
+				return -1;
+		}
+		else if (strcmp(arg, "--shader-cache") == 0)
+		{
+			if (!(config->shader_cache = option_value(&i, argc, argv)))
+				return -1;
+		}
+		else if (strcmp(arg, "--output") == 0)
+		{
+			if (!(config->output = option_value(&i, argc, argv)))
+				return -1;
+		}
+		else if (strcmp(arg, "--encoders") == 0)
+		{
+			if (!(value = option_value(&i, argc, argv)))
+				return -1;
+			config->encoders = (int)strtol(value, &end, 10);
+			if (*end != '\0' || config->encoders <= 0)
+			{
+				fprintf(stderr, "error: expected a positive thread count after '%s'\n", arg);
+				return -1;
+			}
+		}
+		else if (strcmp(arg, "--render-thread") == 0)
+		{
+			config->render_thread = 1;
+		}
+		else if (strcmp(arg, "--jobs") == 0)
+		{
+			if (!(value = option_value(&i, argc, argv)))
+				return -1;
+			config->jobs = (int)strtol(value, &end, 10);
+			if (*end != '\0' || config->jobs <= 0)
+			{
+				fprintf(stderr, "error: expected a positive thread count after '%s'\n", arg);
+				return -1;
+			}
+		}
+		else
+		{
+			if (strcmp(arg, "--help") != 0)
+				fprintf(stderr, "error: unknown argument '%s'\n", arg);
+			config_usage(argv[0]);
+			return -1;
+		}
+	}
+	if (config->idle && config->render_thread)
+	{
+		fprintf(stderr, "error: '--idle' and '--render-thread' can not be used together\n");
+		return -1;
+	}
+	/* frames which are written out are rendered as fast as they can be, by default */
+	if (pacing < 0 && config->output)
+		pacing = PACING_UNCAPPED;
+	else if (pacing < 0)
+		pacing = (config->fps > 0. ? PACING_CAPPED : PACING_VSYNC);
+	config->pacing = (e_pacing)pacing;
+	return 0;
+}
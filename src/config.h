@@ -0,0 +1,41 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include "framepacer.h"
+
+//! The program settings, as given on the command-line
+typedef struct config
+{
+	int			gl_lazy;	//!< If nonzero, GL entry points are resolved on their first call, rather than all at startup
+	int			gl_info;	//!< If nonzero, the GL driver info and available fast paths are printed at startup
+	char const*	bench;		//!< The name of the benchmark to run instead of the example (`NULL` if none)
+	int			width;		//!< The width of the window (or offscreen framebuffer), in pixels
+	int			height;		//!< The height of the window (or offscreen framebuffer), in pixels
+	long		frames;		//!< The amount of frames to render before exiting (`0` to run until the window is closed)
+	int			stats;		//!< If nonzero, a summary of the frame times is printed on exit
+	char const*	stats_csv;	//!< The file to write the timings of every frame to, as CSV (`NULL` if none)
+	char const*	stats_json;	//!< The file to write the frame time summary and timings to, as JSON (`NULL` if none)
+	int			overlay;	//!< If nonzero, a graph of the recent frame times is drawn over each frame
+	e_pacing	pacing;		//!< How frames are paced (vsync by default, capped if only a frame rate is given)
+	double		fps;		//!< The target frame rate, for capped pacing
+	int			low_latency;//!< If nonzero, input is sampled as late as possible before rendering
+	int			idle;		//!< If nonzero, frames are only redrawn when something changed (damage tracking)
+	char const*	scene;		//!< The name of the scene to draw (`NULL` to only clear the screen)
+	char const*	shader_cache;	//!< The directory which keeps program binaries (`NULL` for the default)
+	char const*	output;		//!< The file to write the frames to, rather than showing them (`NULL` if none)
+	int			encoders;	//!< The amount of threads which write the frames out
+	int			jobs;		//!< The amount of threads which run the per-frame jobs, the main one included (`0` for one per CPU)
+	int			render_thread;	//!< If nonzero, frames are rendered on their own thread, while the main thread handles events
+}	s_config;
+
+//! Fills in `config` from the program's command-line arguments
+/*!
+**	@returns
+**	`0` on success, or `-1` if an argument was invalid (a message is printed to `stderr`)
+*/
+int	config_parse(s_config* config, int argc, char** argv);
+
+//! Prints the list of accepted command-line arguments to `stderr`
+void	config_usage(char const* program);
+
+#endif
@@ -0,0 +1,51 @@
+
+#include "damage.h"
+
+void	damage_init(s_damage* damage)
+{
+	atomic_init(&damage->posted, 1);
+	damage->deadline = 0;
+}
+
+void	damage_post(s_damage* damage)
+{
+	/* only the first post since the last redraw needs to wake the main loop */
+	if (!atomic_exchange_explicit(&damage->posted, 1, memory_order_release))
+		window_post_empty_event();
+}
+
+void	damage_schedule(s_damage* damage, uint64_t deadline)
+{
+	if (damage->deadline == 0 || deadline < damage->deadline)
+		damage->deadline = deadline;
+}
+
+int		damage_wait(s_damage* damage, s_window* window)
+{
+	uint64_t now;
+	int reasons;
+
+	/* pick up whatever happened while the last frame was drawn */
+	window_poll_events();
+	for (;;)
+	{
+		if (window_should_close(window))
+			return 0;
+		reasons = 0;
+		if (window_take_damage(window))
+			reasons |= DAMAGE_WINDOW;
+		if (atomic_exchange_explicit(&damage->posted, 0, memory_order_acquire))
+			reasons |= DAMAGE_POSTED;
+		now = window_timer_value();
+		if (damage->deadline != 0 && now >= damage->deadline)
+		{
+			damage->deadline = 0;
+			reasons |= DAMAGE_DEADLINE;
+		}
+		if (reasons)
+			return reasons;
+		/* sleep until the next event, or the next deadline */
+		window_wait_events(damage->deadline == 0 ? -1. :
+			(double)(damage->deadline - now) / (double)window_timer_frequency());
+	}
+}
@@ -0,0 +1,55 @@
+#ifndef DAMAGE_H
+#define DAMAGE_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "window.h"
+
+/*
+**	Damage tracking, for the idle render mode: rather than redrawing every
+**	frame, the main loop sleeps in `window_wait_events()` until something
+**	marks the frame dirty - input or a resize (reported by the window), an
+**	animation deadline which was reached, or an event posted by the
+**	application, possibly from another thread.
+*/
+
+//! The reasons why a frame needs to be redrawn, as returned by `damage_wait()`
+typedef enum damage_reason
+{
+	DAMAGE_WINDOW	= 1 << 0,	//!< Input, a resize, or the window system asked for a redraw
+	DAMAGE_DEADLINE	= 1 << 1,	//!< An animation deadline was reached
+	DAMAGE_POSTED	= 1 << 2,	//!< The application marked the frame dirty, with `damage_post()`
+}	e_damage_reason;
+
+//! Whether the next frame needs to be drawn, and when at the latest
+typedef struct damage
+{
+	atomic_int	posted;		//!< Set by `damage_post()`, from any thread
+	uint64_t	deadline;	//!< The timer value at which to redraw regardless (`0` if none)
+}	s_damage;
+
+//! Sets up damage tracking: the first frame is always dirty
+void	damage_init(s_damage* damage);
+
+//! Marks the frame dirty and wakes up the main loop (this can be called from any thread)
+void	damage_post(s_damage* damage);
+
+//! Makes the frame dirty at the given timer value at the latest (main thread only)
+/*!
+**	If several deadlines are scheduled, the earliest one is kept: animations
+**	call this each frame with the time of their next step.
+*/
+void	damage_schedule(s_damage* damage, uint64_t deadline);
+
+//! Waits until the frame is dirty, processing window events meanwhile
+/*!
+**	@param damage	The damage tracking state
+**	@param window	The window whose input and resizes make the frame dirty
+**	@returns
+**	The reasons (`e_damage_reason` bits) why the frame needs to be redrawn,
+**	or `0` if the window should close instead
+*/
+int		damage_wait(s_damage* damage, s_window* window);
+
+#endif
@@ -0,0 +1,96 @@
+
+#include <stdio.h>
+#include <string.h>
+
+#include "draw_commands.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+
+int		draw_commands_init(s_draw_commands* commands, size_t batch)
+{
+	memset(commands, 0, sizeof(s_draw_commands));
+	commands->batch = (batch ? batch : DRAW_COMMANDS_DEFAULT_BATCH);
+	return gpu_ring_init(&commands->ring, GPU_RING_FRAMES * commands->batch * sizeof(s_draw_elements_command));
+}
+
+void	draw_commands_free(s_draw_commands* commands)
+{
+	gpu_ring_free(&commands->ring);
+	memset(commands, 0, sizeof(s_draw_commands));
+}
+
+size_t	draw_commands_build(s_draw_elements_command* result, s_draw_range const* ranges,
+	s_draw_object const* objects, size_t count)
+{
+	s_draw_elements_command* command;
+	s_draw_range const* range;
+	uint32_t last_range = 0;
+	uint32_t next_instance = 0;
+	size_t written = 0;
+	size_t i;
+
+	for (i = 0; i < count; ++i)
+	{
+		/* the next instance of the same mesh: the previous command draws one more */
+		if (written > 0 && objects[i].range == last_range && objects[i].instance == next_instance)
+			++result[written - 1].instance_count;
+		else
+		{
+			range = &ranges[objects[i].range];
+			command = &result[written++];
+			command->count = range->index_count;
+			command->instance_count = 1;
+			command->first_index = range->first_index;
+			command->base_vertex = range->base_vertex;
+			command->base_instance = objects[i].instance;
+			last_range = objects[i].range;
+		}
+		next_instance = objects[i].instance + 1;
+	}
+	return written;
+}
+
+int		draw_commands_submit(s_draw_commands* commands, GLenum mode, s_draw_range const* ranges,
+	s_draw_object const* objects, size_t count)
+{
+	s_draw_elements_command* mapped;
+	size_t offset;
+	size_t part;
+	size_t written;
+	size_t i;
+
+	if (!gl_caps.base_instance)
+	{
+		fprintf(stderr, "error: indirect draws need a base instance (GL 4.2 or ARB_base_instance)\n");
+		return -1;
+	}
+	for (; count > 0; objects += part, count -= part)
+	{
+		part = (count < commands->batch ? count : commands->batch);
+		/* the commands are aligned to their size in the ring, so that their offset is a whole command index */
+		mapped = (s_draw_elements_command*)gpu_ring_alloc(&commands->ring,
+			part * sizeof(s_draw_elements_command), sizeof(s_draw_elements_command), &offset);
+		if (!mapped)
+		{
+			fprintf(stderr, "error: could not map the indirect command buffer\n");
+			return -1;
+		}
+		written = draw_commands_build(mapped, ranges, objects, part);
+		gpu_ring_flush(&commands->ring);
+		gl_state_bind_buffer(GL_DRAW_INDIRECT_BUFFER, commands->ring.buffer);
+		if (gl_caps.multi_draw_indirect)
+		{
+			glMultiDrawElementsIndirect(mode, GL_UNSIGNED_SHORT, (void const*)offset, (GLsizei)written, 0);
+			++commands->draw_calls;
+		}
+		else
+		{
+			for (i = 0; i < written; ++i)
+				glDrawElementsIndirect(mode, GL_UNSIGNED_SHORT, (void const*)(offset + i * sizeof(s_draw_elements_command)));
+			commands->draw_calls += (long)written;
+		}
+		commands->commands += (long)written;
+		gpu_ring_fence(&commands->ring);
+	}
+	return 0;
+}
@@ -0,0 +1,96 @@
+#ifndef DRAW_COMMANDS_H
+#define DRAW_COMMANDS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <glad/glad.h>
+
+#include "gpu_ring.h"
+
+/*
+**	Indirect draw submission: the scene is described as a flat list of
+**	objects (which mesh, which instance data), whose meshes live in shared
+**	vertex/index buffers. Each frame, the list is turned into
+**	`DrawElementsIndirectCommand`s written straight into a ring buffer bound
+**	as the `GL_DRAW_INDIRECT_BUFFER`, and drawn with one
+**	`glMultiDrawElementsIndirect()` (or a tight loop of
+**	`glDrawElementsIndirect()`): there are no per-object state or uniform
+**	changes. The same commands could later be written by a culling shader.
+**	The instance data is found with each command's base instance, which
+**	needs `gl_caps.base_instance`.
+*/
+
+//! The default amount of commands written at once: past this, the objects are drawn in several parts
+#define DRAW_COMMANDS_DEFAULT_BATCH	65536
+
+//! An indexed draw, as read by `glDrawElementsIndirect()` (20 bytes, tightly packed)
+typedef struct draw_elements_command
+{
+	GLuint	count;			//!< The amount of indices
+	GLuint	instance_count;
+	GLuint	first_index;	//!< The first index, counted in indices from the start of the index buffer
+	GLint	base_vertex;	//!< Added to each index
+	GLuint	base_instance;	//!< The index of the first instance, for the attributes which have a divisor
+}	s_draw_elements_command;
+
+//! Where a mesh lies in the shared vertex and index buffers
+typedef struct draw_range
+{
+	GLuint	first_index;
+	GLuint	index_count;
+	GLint	base_vertex;
+}	s_draw_range;
+
+//! One object of the scene
+typedef struct draw_object
+{
+	uint32_t	range;		//!< The index of its mesh's range
+	uint32_t	instance;	//!< The index of its instance data
+}	s_draw_object;
+
+//! The indirect command buffer, and how it was used
+typedef struct draw_commands
+{
+	s_gpu_ring	ring;		//!< Holds the commands of the last few batches
+	size_t		batch;		//!< The most commands written at once
+	long		draw_calls;	//!< The amount of GL draw calls since `draw_commands_init()`
+	long		commands;	//!< The amount of indirect commands drawn since `draw_commands_init()`
+}	s_draw_commands;
+
+//! Creates the indirect command buffer, returns `0` on success
+/*!
+**	@param commands	The indirect command buffer to set up
+**	@param batch	The most commands to write at once (`0` for `DRAW_COMMANDS_DEFAULT_BATCH`):
+**					the buffer holds `GPU_RING_FRAMES` batches
+*/
+int		draw_commands_init(s_draw_commands* commands, size_t batch);
+//! Deletes the indirect command buffer
+void	draw_commands_free(s_draw_commands* commands);
+
+//! Writes the draw commands for a list of objects, returns the amount of commands written
+/*!
+**	Consecutive objects which use the same mesh and consecutive instances are
+**	merged into a single instanced command, so there are at most `count` commands.
+**	@param result	Receives the commands (`count` of them at most)
+**	@param ranges	The ranges of the meshes, which the objects refer to
+**	@param objects	The objects to draw, in order
+**	@param count	The amount of items in `objects`
+*/
+size_t	draw_commands_build(s_draw_elements_command* result, s_draw_range const* ranges,
+			s_draw_object const* objects, size_t count);
+
+//! Draws a list of objects with indirect draws, returns `0` on success
+/*!
+**	The vertex array (with the shared index buffer), the program and the rest of
+**	the state must be set up already; the index type is `GL_UNSIGNED_SHORT`.
+**	@param commands	The indirect command buffer to write the commands to
+**	@param mode		The kind of primitives to draw
+**	@param ranges	The ranges of the meshes, which the objects refer to
+**	@param objects	The objects to draw, in order
+**	@param count	The amount of items in `objects`
+*/
+int		draw_commands_submit(s_draw_commands* commands, GLenum mode, s_draw_range const* ranges,
+			s_draw_object const* objects, size_t count);
+
+#endif
@@ -0,0 +1,376 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include "ecs.h"
+
+//! The alignment of the chunks, and of the arrays in them (a cache line)
+#define ECS_ALIGNMENT	64
+//! Where the first array of a chunk starts, past its header
+#define ECS_HEADER		((sizeof(s_ecs_chunk) + ECS_ALIGNMENT - 1) / ECS_ALIGNMENT * ECS_ALIGNMENT)
+
+#define ENTITY_INDEX(entity)		((entity) & (ECS_MAX_ENTITIES - 1))
+#define ENTITY_GENERATION(entity)	((entity) >> 24)
+
+static size_t const	component_sizes[ENUMLENGTH_ECS_COMPONENT] =
+{
+	[ECS_TRANSFORM] = sizeof(s_ecs_transform),
+	[ECS_SPIN]      = sizeof(float),
+	[ECS_BOUNDS]    = sizeof(s_ecs_bounds),
+	[ECS_COLOR]     = sizeof(s_ecs_color),
+};
+
+static size_t	align(size_t size)
+{
+	return (size + ECS_ALIGNMENT - 1) / ECS_ALIGNMENT * ECS_ALIGNMENT;
+}
+
+size_t		ecs_component_size(e_ecs_component component)
+{
+	return component_sizes[component];
+}
+
+void		ecs_init(s_ecs* ecs)
+{
+	memset(ecs, 0, sizeof(s_ecs));
+	ecs->free_record = ECS_NONE;
+}
+
+static void	chunk_free(s_ecs_chunk* chunk)
+{
+#ifdef _WIN32
+	_aligned_free(chunk);
+#else
+	free(chunk);
+#endif
+}
+
+void		ecs_free(s_ecs* ecs)
+{
+	s_ecs_archetype* archetype;
+	size_t i;
+	int a;
+
+	for (a = 0; a < ecs->archetype_count; ++a)
+	{
+		archetype = &ecs->archetypes[a];
+		for (i = 0; i < archetype->chunk_count; ++i)
+			chunk_free(archetype->chunks[i]);
+		free(archetype->chunks);
+	}
+	free(ecs->records);
+	ecs_init(ecs);
+}
+
+//! Returns the archetype with the given components, creating it if needed (or `NULL` if there are too many)
+static s_ecs_archetype*	archetype_get(s_ecs* ecs, uint32_t mask)
+{
+	s_ecs_archetype* archetype;
+	size_t row_size = sizeof(t_ecs_entity);
+	size_t columns = 1;
+	size_t offset;
+	int c, a;
+
+	for (a = 0; a < ecs->archetype_count; ++a)
+	{
+		if (ecs->archetypes[a].mask == mask)
+			return &ecs->archetypes[a];
+	}
+	if (ecs->archetype_count == ECS_MAX_ARCHETYPES)
+	{
+		fprintf(stderr, "error: there are more than %d archetypes\n", ECS_MAX_ARCHETYPES);
+		return NULL;
+	}
+	archetype = &ecs->archetypes[ecs->archetype_count++];
+	memset(archetype, 0, sizeof(s_ecs_archetype));
+	archetype->mask = mask;
+	for (c = 0; c < ENUMLENGTH_ECS_COMPONENT; ++c)
+	{
+		if ((mask & ECS_BIT(c)) && component_sizes[c])
+		{
+			row_size += component_sizes[c];
+			++columns;
+		}
+	}
+	/* each array may lose up to a cache line to the alignment of the next one */
+	archetype->capacity = (uint32_t)((ECS_CHUNK_SIZE - ECS_HEADER - columns * ECS_ALIGNMENT) / row_size);
+	offset = ECS_HEADER;
+	archetype->entities = (uint16_t)offset;
+	offset += align(archetype->capacity * sizeof(t_ecs_entity));
+	for (c = 0; c < ENUMLENGTH_ECS_COMPONENT; ++c)
+	{
+		if ((mask & ECS_BIT(c)) && component_sizes[c])
+		{
+			archetype->offsets[c] = (uint16_t)offset;
+			offset += align(archetype->capacity * component_sizes[c]);
+		}
+	}
+	return archetype;
+}
+
+void*		ecs_column(s_ecs_chunk* chunk, e_ecs_component component)
+{
+	return (unsigned char*)chunk + chunk->archetype->offsets[component];
+}
+
+t_ecs_entity*	ecs_chunk_entities(s_ecs_chunk* chunk)
+{
+	return (t_ecs_entity*)((unsigned char*)chunk + chunk->archetype->entities);
+}
+
+//! Appends a zeroed row for `entity` to an archetype, returns its chunk (or `NULL` if out of memory)
+static s_ecs_chunk*	row_add(s_ecs_archetype* archetype, t_ecs_entity entity, uint32_t* row)
+{
+	s_ecs_chunk* chunk = (archetype->chunk_count ? archetype->chunks[archetype->chunk_count - 1] : NULL);
+	s_ecs_chunk** chunks;
+	size_t capacity;
+	int c;
+
+	if (!chunk || chunk->count == archetype->capacity)
+	{
+		if (archetype->chunk_count == archetype->chunk_capacity)
+		{
+			capacity = (archetype->chunk_capacity ? archetype->chunk_capacity * 2 : 16);
+			if (!(chunks = (s_ecs_chunk**)realloc(archetype->chunks, capacity * sizeof(s_ecs_chunk*))))
+				return NULL;
+			archetype->chunks = chunks;
+			archetype->chunk_capacity = capacity;
+		}
+#ifdef _WIN32
+		chunk = (s_ecs_chunk*)_aligned_malloc(ECS_CHUNK_SIZE, ECS_ALIGNMENT);
+#else
+		chunk = (s_ecs_chunk*)aligned_alloc(ECS_ALIGNMENT, ECS_CHUNK_SIZE);
+#endif
+		if (!chunk)
+			return NULL;
+		chunk->archetype = archetype;
+		chunk->count = 0;
+		chunk->index = (uint32_t)archetype->chunk_count;
+		archetype->chunks[archetype->chunk_count++] = chunk;
+	}
+	*row = chunk->count++;
+	ecs_chunk_entities(chunk)[*row] = entity;
+	for (c = 0; c < ENUMLENGTH_ECS_COMPONENT; ++c)
+	{
+		if (archetype->offsets[c])
+			memset((unsigned char*)ecs_column(chunk, (e_ecs_component)c) + *row * component_sizes[c], 0, component_sizes[c]);
+	}
+	++archetype->count;
+	return chunk;
+}
+
+//! Removes a row from its archetype, moving the archetype's last row into its place
+static void	row_remove(s_ecs* ecs, s_ecs_chunk* chunk, uint32_t row)
+{
+	s_ecs_archetype* archetype = chunk->archetype;
+	s_ecs_chunk* last = archetype->chunks[archetype->chunk_count - 1];
+	uint32_t last_row = last->count - 1;
+	t_ecs_entity moved;
+	size_t size;
+	int c;
+
+	if (last != chunk || last_row != row)
+	{
+		moved = ecs_chunk_entities(last)[last_row];
+		ecs_chunk_entities(chunk)[row] = moved;
+		for (c = 0; c < ENUMLENGTH_ECS_COMPONENT; ++c)
+		{
+			if (!archetype->offsets[c])
+				continue;
+			size = component_sizes[c];
+			memcpy((unsigned char*)ecs_column(chunk, (e_ecs_component)c) + row * size,
+				(unsigned char*)ecs_column(last, (e_ecs_component)c) + last_row * size, size);
+		}
+		ecs->records[ENTITY_INDEX(moved)].chunk = chunk;
+		ecs->records[ENTITY_INDEX(moved)].row = row;
+	}
+	--last->count;
+	--archetype->count;
+	if (last->count == 0)
+	{
+		chunk_free(last);
+		--archetype->chunk_count;
+	}
+}
+
+//! Returns the record of a free entity id, or `ECS_NONE` if there are too many
+static uint32_t	record_alloc(s_ecs* ecs)
+{
+	s_ecs_record* records;
+	uint32_t capacity;
+	uint32_t index;
+
+	if (ecs->free_record != ECS_NONE)
+	{
+		index = ecs->free_record;
+		ecs->free_record = ecs->records[index].row;
+		return index;
+	}
+	if (ecs->record_count == ECS_MAX_ENTITIES)
+	{
+		fprintf(stderr, "error: there are more than %u entities\n", ECS_MAX_ENTITIES);
+		return ECS_NONE;
+	}
+	if (ecs->record_count == ecs->record_capacity)
+	{
+		capacity = (ecs->record_capacity ? ecs->record_capacity * 2 : 1024);
+		if (!(records = (s_ecs_record*)realloc(ecs->records, capacity * sizeof(s_ecs_record))))
+			return ECS_NONE;
+		ecs->records = records;
+		ecs->record_capacity = capacity;
+	}
+	ecs->records[ecs->record_count].generation = 0;
+	return ecs->record_count++;
+}
+
+//! Frees the record of an entity, changing its generation so that its id does not match anymore
+static void	record_release(s_ecs* ecs, uint32_t index)
+{
+	ecs->records[index].chunk = NULL;
+	ecs->records[index].generation = (ecs->records[index].generation + 1) & 0xFF;
+	ecs->records[index].row = ecs->free_record;
+	ecs->free_record = index;
+}
+
+t_ecs_entity	ecs_create(s_ecs* ecs, uint32_t mask)
+{
+	s_ecs_archetype* archetype = archetype_get(ecs, mask);
+	s_ecs_record* record;
+	t_ecs_entity entity;
+	uint32_t index;
+
+	if (!archetype || (index = record_alloc(ecs)) == ECS_NONE)
+		return ECS_NONE;
+	record = &ecs->records[index];
+	entity = index | record->generation << 24;
+	if (!(record->chunk = row_add(archetype, entity, &record->row)))
+	{
+		fprintf(stderr, "error: could not allocate an entity chunk\n");
+		record_release(ecs, index);
+		return ECS_NONE;
+	}
+	++ecs->count;
+	return entity;
+}
+
+int			ecs_alive(s_ecs const* ecs, t_ecs_entity entity)
+{
+	uint32_t index = ENTITY_INDEX(entity);
+
+	return (entity != ECS_NONE && index < ecs->record_count && ecs->records[index].chunk &&
+		ecs->records[index].generation == ENTITY_GENERATION(entity));
+}
+
+int			ecs_destroy(s_ecs* ecs, t_ecs_entity entity)
+{
+	s_ecs_record* record;
+
+	if (!ecs_alive(ecs, entity))
+		return -1;
+	record = &ecs->records[ENTITY_INDEX(entity)];
+	row_remove(ecs, record->chunk, record->row);
+	record_release(ecs, ENTITY_INDEX(entity));
+	--ecs->count;
+	return 0;
+}
+
+int			ecs_change(s_ecs* ecs, t_ecs_entity entity, uint32_t mask)
+{
+	s_ecs_archetype* archetype;
+	s_ecs_record* record;
+	s_ecs_chunk* chunk;
+	uint32_t row;
+	int c;
+
+	if (!ecs_alive(ecs, entity))
+		return -1;
+	record = &ecs->records[ENTITY_INDEX(entity)];
+	if (record->chunk->archetype->mask == mask)
+		return 0;
+	if (!(archetype = archetype_get(ecs, mask)))
+		return -1;
+	if (!(chunk = row_add(archetype, entity, &row)))
+	{
+		fprintf(stderr, "error: could not allocate an entity chunk\n");
+		return -1;
+	}
+	/* the components which the entity keeps are copied over, before its old row is reused */
+	for (c = 0; c < ENUMLENGTH_ECS_COMPONENT; ++c)
+	{
+		if (archetype->offsets[c] && record->chunk->archetype->offsets[c])
+			memcpy((unsigned char*)ecs_column(chunk, (e_ecs_component)c) + row * component_sizes[c],
+				(unsigned char*)ecs_column(record->chunk, (e_ecs_component)c) + record->row * component_sizes[c],
+				component_sizes[c]);
+	}
+	row_remove(ecs, record->chunk, record->row);
+	record->chunk = chunk;
+	record->row = row;
+	return 0;
+}
+
+void*		ecs_get(s_ecs* ecs, t_ecs_entity entity, e_ecs_component component)
+{
+	s_ecs_record* record;
+
+	if (!ecs_alive(ecs, entity))
+		return NULL;
+	record = &ecs->records[ENTITY_INDEX(entity)];
+	if (!record->chunk->archetype->offsets[component])
+		return NULL;
+	return (unsigned char*)ecs_column(record->chunk, component) + record->row * component_sizes[component];
+}
+
+void		ecs_query_init(s_ecs_query* query, s_ecs* ecs, uint32_t mask)
+{
+	query->ecs = ecs;
+	query->mask = mask;
+	query->archetype = 0;
+	query->chunk = 0;
+}
+
+s_ecs_chunk*	ecs_query_next(s_ecs_query* query)
+{
+	s_ecs_archetype* archetype;
+
+	for (; query->archetype < query->ecs->archetype_count; ++query->archetype, query->chunk = 0)
+	{
+		archetype = &query->ecs->archetypes[query->archetype];
+		if ((archetype->mask & query->mask) == query->mask && query->chunk < archetype->chunk_count)
+			return archetype->chunks[query->chunk++];
+	}
+	return NULL;
+}
+
+size_t		ecs_count(s_ecs const* ecs, uint32_t mask)
+{
+	size_t count = 0;
+	int a;
+
+	for (a = 0; a < ecs->archetype_count; ++a)
+	{
+		if ((ecs->archetypes[a].mask & mask) == mask)
+			count += ecs->archetypes[a].count;
+	}
+	return count;
+}
+
+size_t		ecs_chunks(s_ecs* ecs, uint32_t mask, s_ecs_chunk** chunks, size_t max)
+{
+	s_ecs_query query;
+	s_ecs_chunk* chunk;
+	size_t count = 0;
+
+	ecs_query_init(&query, ecs, mask);
+	while ((chunk = ecs_query_next(&query)))
+	{
+		if (count < max)
+			chunks[count] = chunk;
+		++count;
+	}
+	return count;
+}
@@ -0,0 +1,160 @@
+#ifndef ECS_H
+#define ECS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "meshes.h"
+
+/*
+**	The scene's storage: entities are plain ids, and their data lives in
+**	components, stored by archetype (the set of components which an entity
+**	has). Each archetype keeps its entities in 16 KiB chunks, one array per
+**	component in each chunk (a structure of arrays): a system which reads
+**	transforms only streams through transforms, chunk after chunk, rather
+**	than chasing a pointer per object. The chunks of an archetype are full,
+**	but for its last one: destroying an entity moves the archetype's last
+**	entity into its place. Chunks can be shared out between jobs, each one
+**	being independent of the others.
+**	Entity ids are checked with a generation, which changes each time an
+**	id is reused: a destroyed entity's id is never mistaken for a new one.
+*/
+
+//! The size of a chunk, header included, in bytes
+#define ECS_CHUNK_SIZE		16384
+//! The most distinct archetypes
+#define ECS_MAX_ARCHETYPES	64
+//! The most entities alive at once
+#define ECS_MAX_ENTITIES	(1u << 24)
+//! Not an entity, returned on failure
+#define ECS_NONE			0xFFFFFFFFu
+
+//! The mask of a component, in archetype masks
+#define ECS_BIT(component)	(1u << (component))
+
+//! The components which entities can have
+typedef enum ecs_component
+{
+	ECS_TRANSFORM,	//!< `s_ecs_transform`
+	ECS_SPIN,		//!< `float`: how fast the transform turns around the Y axis, in radians per second
+	ECS_BOUNDS,		//!< `s_ecs_bounds`: a bounding sphere, in world space
+	ECS_COLOR,		//!< `s_ecs_color`
+	ECS_MESH,		//!< A tag (without any data) per built-in mesh: `ECS_MESH + e_mesh_shape`
+	ENUMLENGTH_ECS_COMPONENT = ECS_MESH + ENUMLENGTH_MESH_SHAPE
+}	e_ecs_component;
+
+//! Where an entity is, and how it is turned
+typedef struct ecs_transform
+{
+	float	position[3];
+	float	scale;		//!< Uniform
+	float	angle;		//!< Around the Y axis, in radians
+}	s_ecs_transform;
+
+typedef struct ecs_bounds
+{
+	float	center[3];
+	float	radius;
+}	s_ecs_bounds;
+
+typedef struct ecs_color
+{
+	uint8_t	rgba[4];	//!< 255 is 1.0
+}	s_ecs_color;
+
+//! An entity's id: its index in the world's records (low 24 bits), and the generation of that record (high 8 bits)
+typedef uint32_t	t_ecs_entity;
+
+struct ecs_archetype;
+
+//! The header of a chunk, which the component arrays follow (aligned to 64 bytes each)
+typedef struct ecs_chunk
+{
+	struct ecs_archetype*	archetype;
+	uint32_t				count;		//!< The amount of entities in the chunk
+	uint32_t				index;		//!< The index of the chunk in its archetype
+}	s_ecs_chunk;
+
+//! The entities which have the same components, and the chunks which they are stored in
+typedef struct ecs_archetype
+{
+	uint32_t		mask;		//!< The `ECS_BIT()` of each of its components
+	uint32_t		capacity;	//!< The amount of entities in a chunk
+	uint16_t		offsets[ENUMLENGTH_ECS_COMPONENT];	//!< Where the array of each component starts in a chunk (`0` if it has none)
+	uint16_t		entities;	//!< Where the array of entity ids starts in a chunk
+	s_ecs_chunk**	chunks;
+	size_t			chunk_count;
+	size_t			chunk_capacity;
+	size_t			count;		//!< The amount of entities, in all of its chunks
+}	s_ecs_archetype;
+
+//! Where an entity is stored (or, for a free record, which record is free next)
+typedef struct ecs_record
+{
+	s_ecs_chunk*	chunk;		//!< `NULL` if the record is free
+	uint32_t		row;		//!< The index of the entity in its chunk, or the next free record
+	uint32_t		generation;
+}	s_ecs_record;
+
+//! The entities, and their components
+typedef struct ecs
+{
+	s_ecs_archetype	archetypes[ECS_MAX_ARCHETYPES];
+	int				archetype_count;
+	s_ecs_record*	records;
+	uint32_t		record_count;
+	uint32_t		record_capacity;
+	uint32_t		free_record;	//!< The first free record (`ECS_NONE` if none)
+	size_t			count;			//!< The amount of entities alive
+}	s_ecs;
+
+//! Walks the chunks of every archetype which has a set of components
+typedef struct ecs_query
+{
+	s_ecs*		ecs;
+	uint32_t	mask;
+	int			archetype;	//!< The archetype which is walked
+	size_t		chunk;		//!< Its next chunk
+}	s_ecs_query;
+
+//! Returns the size of the data of a component (`0` for a tag)
+size_t		ecs_component_size(e_ecs_component component);
+
+void		ecs_init(s_ecs* ecs);
+//! Frees every chunk (and so destroys every entity)
+void		ecs_free(s_ecs* ecs);
+
+//! Creates an entity with the given components (their data is zeroed), returns it, or `ECS_NONE` on failure
+t_ecs_entity	ecs_create(s_ecs* ecs, uint32_t mask);
+//! Destroys an entity, returns `0` on success, or `-1` if it was not alive
+int			ecs_destroy(s_ecs* ecs, t_ecs_entity entity);
+//! Returns nonzero if an entity is alive
+int			ecs_alive(s_ecs const* ecs, t_ecs_entity entity);
+//! Changes the components of an entity, keeping the data of those which it still has, returns `0` on success
+int			ecs_change(s_ecs* ecs, t_ecs_entity entity, uint32_t mask);
+//! Returns the data of one of the components of an entity, or `NULL` if it has no such component or is not alive
+void*		ecs_get(s_ecs* ecs, t_ecs_entity entity, e_ecs_component component);
+
+//! Returns the array of a component in a chunk (its archetype must have the component)
+void*		ecs_column(s_ecs_chunk* chunk, e_ecs_component component);
+//! Returns the array of the entity ids in a chunk
+t_ecs_entity*	ecs_chunk_entities(s_ecs_chunk* chunk);
+
+//! Starts walking the chunks of the archetypes which have (at least) the components of `mask`
+void		ecs_query_init(s_ecs_query* query, s_ecs* ecs, uint32_t mask);
+//! Returns the next chunk, or `NULL` once they were all walked
+s_ecs_chunk*	ecs_query_next(s_ecs_query* query);
+//! Returns the amount of entities which have (at least) the components of `mask`
+size_t		ecs_count(s_ecs const* ecs, uint32_t mask);
+//! Lists the chunks of the archetypes which have (at least) the components of `mask`, returns their amount
+/*!
+**	@param ecs		The world
+**	@param mask		The components which the chunks must have
+**	@param chunks	Receives the chunks, up to `max` of them (may be `NULL` if `max` is 0)
+**	@param max		The amount of chunks which `chunks` can hold
+**	@returns
+**	The amount of chunks, which may be more than `max`
+*/
+size_t		ecs_chunks(s_ecs* ecs, uint32_t mask, s_ecs_chunk** chunks, size_t max);
+
+#endif
@@ -0,0 +1,433 @@
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ENCODER_SSE2
+#endif
+
+#include "encoder.h"
+#include "image_png.h"
+#include "window.h"
+
+//! The file extensions of each format
+static char const* const	extensions[ENUMLENGTH_ENCODER_FORMAT] =
+{
+	".yuv",
+	".y4m",
+	".png",
+};
+
+//! Returns the current time, in milliseconds
+static double	now_ms(void)
+{
+	return (double)window_timer_value() * 1000. / (double)window_timer_frequency();
+}
+
+int		encoder_format_find(char const* path)
+{
+	size_t length = strlen(path);
+	size_t extension;
+	int i;
+
+	for (i = 0; i < ENUMLENGTH_ENCODER_FORMAT; ++i)
+	{
+		extension = strlen(extensions[i]);
+		if (length > extension && strcmp(path + length - extension, extensions[i]) == 0)
+			return i;
+	}
+	return -1;
+}
+
+//! Returns nonzero if `pattern` holds a single conversion, which is a `%d` (with a width, maybe)
+static int	is_frame_pattern(char const* pattern)
+{
+	int conversions = 0;
+
+	while ((pattern = strchr(pattern, '%')))
+	{
+		++pattern;
+		while (*pattern >= '0' && *pattern <= '9')
+			++pattern;
+		if (*pattern != 'd')
+			return 0;
+		++conversions;
+	}
+	return (conversions == 1);
+}
+
+//! Converts 2 rows of pixels to I420, from the column `x` on
+static void	convert_rows(uint8_t* luma0, uint8_t* luma1, uint8_t* u, uint8_t* v,
+	uint8_t const* rgba0, uint8_t const* rgba1, int x, int width)
+{
+	uint8_t const* p[4];
+	int r, g, b;
+	int i;
+
+	for (; x < width; x += 2)
+	{
+		p[0] = rgba0 + x * 4;
+		p[1] = p[0] + 4;
+		p[2] = rgba1 + x * 4;
+		p[3] = p[2] + 4;
+		r = g = b = 0;
+		for (i = 0; i < 4; ++i)
+		{
+			(i < 2 ? luma0 : luma1)[x + (i & 1)] = (uint8_t)(((66 * p[i][0] + 129 * p[i][1] + 25 * p[i][2] + 128) >> 8) + 16);
+			r += p[i][0];
+			g += p[i][1];
+			b += p[i][2];
+		}
+		/* the chroma is taken from the average of the 2x2 block */
+		r = (r + 2) >> 2;
+		g = (g + 2) >> 2;
+		b = (b + 2) >> 2;
+		u[x / 2] = (uint8_t)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+		v[x / 2] = (uint8_t)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+	}
+}
+
+#ifdef ENCODER_SSE2
+
+//! Splits 8 RGBA pixels into their red, green and blue channels, as 16-bit lanes
+static void	split_channels(uint8_t const* rgba, __m128i* r, __m128i* g, __m128i* b)
+{
+	__m128i const mask = _mm_set1_epi32(0xFF);
+	__m128i lo = _mm_loadu_si128((__m128i const*)rgba);
+	__m128i hi = _mm_loadu_si128((__m128i const*)(rgba + 16));
+
+	*r = _mm_packs_epi32(_mm_and_si128(lo, mask), _mm_and_si128(hi, mask));
+	*g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 8), mask), _mm_and_si128(_mm_srli_epi32(hi, 8), mask));
+	*b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 16), mask), _mm_and_si128(_mm_srli_epi32(hi, 16), mask));
+}
+
+//! Returns the luma of 8 pixels, as 16-bit lanes (the sums fit in 16 unsigned bits)
+static __m128i	luma(__m128i r, __m128i g, __m128i b)
+{
+	__m128i y = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(66)), _mm_mullo_epi16(g, _mm_set1_epi16(129)));
+
+	y = _mm_add_epi16(y, _mm_add_epi16(_mm_mullo_epi16(b, _mm_set1_epi16(25)), _mm_set1_epi16(128)));
+	return _mm_add_epi16(_mm_srli_epi16(y, 8), _mm_set1_epi16(16));
+}
+
+//! Returns the average of each 2x2 block of 8 columns of 2 rows, then 8 more, as 16-bit lanes
+static __m128i	average(__m128i top_lo, __m128i bottom_lo, __m128i top_hi, __m128i bottom_hi)
+{
+	__m128i const ones = _mm_set1_epi16(1);
+	__m128i sums = _mm_packs_epi32(_mm_madd_epi16(_mm_add_epi16(top_lo, bottom_lo), ones),
+		_mm_madd_epi16(_mm_add_epi16(top_hi, bottom_hi), ones));
+
+	return _mm_srli_epi16(_mm_add_epi16(sums, _mm_set1_epi16(2)), 2);
+}
+
+//! Returns the chroma of 8 pixels, as 16-bit lanes
+static __m128i	chroma(__m128i r, __m128i g, __m128i b, short cr, short cg, short cb)
+{
+	__m128i c = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(cr)), _mm_mullo_epi16(g, _mm_set1_epi16(cg)));
+
+	c = _mm_add_epi16(c, _mm_add_epi16(_mm_mullo_epi16(b, _mm_set1_epi16(cb)), _mm_set1_epi16(128)));
+	return _mm_add_epi16(_mm_srai_epi16(c, 8), _mm_set1_epi16(128));
+}
+
+//! Converts 2 rows of pixels to I420, 16 columns at a time, returns the amount of columns which were converted
+static int	convert_rows_sse2(uint8_t* luma0, uint8_t* luma1, uint8_t* u, uint8_t* v,
+	uint8_t const* rgba0, uint8_t const* rgba1, int width)
+{
+	__m128i r[4], g[4], b[4];
+	__m128i ar, ag, ab;
+	int x;
+
+	for (x = 0; x + 16 <= width; x += 16)
+	{
+		/* 0 and 1 are the halves of the top row, 2 and 3 of the bottom one */
+		split_channels(rgba0 + x * 4, &r[0], &g[0], &b[0]);
+		split_channels(rgba0 + x * 4 + 32, &r[1], &g[1], &b[1]);
+		split_channels(rgba1 + x * 4, &r[2], &g[2], &b[2]);
+		split_channels(rgba1 + x * 4 + 32, &r[3], &g[3], &b[3]);
+		_mm_storeu_si128((__m128i*)(luma0 + x),
+			_mm_packus_epi16(luma(r[0], g[0], b[0]), luma(r[1], g[1], b[1])));
+		_mm_storeu_si128((__m128i*)(luma1 + x),
+			_mm_packus_epi16(luma(r[2], g[2], b[2]), luma(r[3], g[3], b[3])));
+		ar = average(r[0], r[2], r[1], r[3]);
+		ag = average(g[0], g[2], g[1], g[3]);
+		ab = average(b[0], b[2], b[1], b[3]);
+		_mm_storel_epi64((__m128i*)(u + x / 2), _mm_packus_epi16(chroma(ar, ag, ab, -38, -74, 112), _mm_setzero_si128()));
+		_mm_storel_epi64((__m128i*)(v + x / 2), _mm_packus_epi16(chroma(ar, ag, ab, 112, -94, -18), _mm_setzero_si128()));
+	}
+	return x;
+}
+
+#endif
+
+void	encoder_rgba_to_i420(uint8_t* yuv, uint8_t const* rgba, ptrdiff_t stride, int width, int height)
+{
+	uint8_t* u = yuv + (size_t)width * (size_t)height;
+	uint8_t* v = u + (size_t)(width / 2) * (size_t)(height / 2);
+	uint8_t const* rows;
+	uint8_t* luma0;
+	int x = 0;
+	int y;
+
+	for (y = 0; y < height; y += 2)
+	{
+		rows = rgba + stride * y;
+		luma0 = yuv + (size_t)width * (size_t)y;
+#ifdef ENCODER_SSE2
+		x = convert_rows_sse2(luma0, luma0 + width, u, v, rows, rows + stride, width);
+#endif
+		convert_rows(luma0, luma0 + width, u, v, rows, rows + stride, x, width);
+		u += width / 2;
+		v += width / 2;
+	}
+}
+
+//! Writes a frame out, returns `0` on success
+/*!
+**	@param waited	Receives the time which was spent waiting for the previous frames to be written, in milliseconds
+*/
+static int	encode(s_encoder* encoder, s_encoder_job* job, double* waited)
+{
+	size_t size = (size_t)encoder->width * (size_t)encoder->height * 3 / 2;
+	char path[1024];
+	double start;
+	int status = 0;
+
+	/* once a write failed, the output is broken: the later frames are dropped */
+	if (atomic_load(&encoder->failed))
+		status = -1;
+	if (encoder->format == ENCODER_FORMAT_PNG)
+	{
+		if (status)
+			return status;
+		snprintf(path, sizeof(path), encoder->path, (int)job->index);
+		return image_png_save(path, job->rgba, encoder->width, encoder->height);
+	}
+	if (status == 0)
+		encoder_rgba_to_i420(job->yuv, job->rgba, (ptrdiff_t)encoder->width * 4, encoder->width, encoder->height);
+	/* the frames are converted in parallel, but go into the stream in order (a dropped frame still takes its turn) */
+	start = now_ms();
+	pthread_mutex_lock(&encoder->write_lock);
+	while (encoder->written != job->index)
+		pthread_cond_wait(&encoder->turn, &encoder->write_lock);
+	*waited = now_ms() - start;
+	/* the frames before may have failed meanwhile */
+	if (atomic_load(&encoder->failed))
+		status = -1;
+	else if ((encoder->format == ENCODER_FORMAT_Y4M && fputs("FRAME\n", encoder->file) == EOF) ||
+		fwrite(job->yuv, 1, size, encoder->file) != size)
+	{
+		fprintf(stderr, "error: could not write frame %ld to '%s'\n", job->index, encoder->path);
+		atomic_store(&encoder->failed, 1);
+		status = -1;
+	}
+	++encoder->written;
+	pthread_cond_broadcast(&encoder->turn);
+	pthread_mutex_unlock(&encoder->write_lock);
+	return status;
+}
+
+//! Writes the queued frames out, until the encoder is freed
+static void*	worker_run(void* data)
+{
+	s_encoder* encoder = (s_encoder*)data;
+	s_encoder_job* job;
+	double start, waited;
+	int status;
+
+	pthread_mutex_lock(&encoder->lock);
+	for (;;)
+	{
+		while (encoder->queued_count == 0 && !encoder->quit)
+			pthread_cond_wait(&encoder->queued_cond, &encoder->lock);
+		if (encoder->queued_count == 0)
+			break;
+		job = encoder->queued[encoder->queued_head];
+		encoder->queued_head = (encoder->queued_head + 1) % encoder->job_count;
+		--encoder->queued_count;
+		pthread_mutex_unlock(&encoder->lock);
+		start = now_ms();
+		waited = 0.;
+		status = encode(encoder, job, &waited);
+		pthread_mutex_lock(&encoder->lock);
+		encoder->encode_ms += now_ms() - start - waited;
+		if (status == 0)
+			++encoder->encoded;
+		else
+			atomic_store(&encoder->failed, 1);
+		encoder->spare[encoder->spare_count++] = job;
+		pthread_cond_signal(&encoder->freed);
+	}
+	pthread_mutex_unlock(&encoder->lock);
+	return NULL;
+}
+
+//! Frees the buffers of the queue, and closes the stream, returns `0` if it was closed without errors
+static int	close_output(s_encoder* encoder)
+{
+	int status = 0;
+	int i;
+
+	for (i = 0; i < encoder->job_count; ++i)
+	{
+		free(encoder->jobs[i].rgba);
+		free(encoder->jobs[i].yuv);
+	}
+	if (encoder->file && fclose(encoder->file) != 0)
+	{
+		fprintf(stderr, "error: could not write '%s'\n", encoder->path);
+		status = -1;
+	}
+	return status;
+}
+
+//! Allocates the buffers of the queue, and opens the stream, returns `0` on success
+static int	open_output(s_encoder* encoder, double fps)
+{
+	size_t size = (size_t)encoder->width * (size_t)encoder->height * 4;
+	s_encoder_job* job;
+	int i;
+
+	for (i = 0; i < encoder->job_count; ++i)
+	{
+		job = &encoder->jobs[i];
+		if (!(job->rgba = (uint8_t*)malloc(size)) ||
+			(encoder->format != ENCODER_FORMAT_PNG && !(job->yuv = (uint8_t*)malloc(size * 3 / 8))))
+		{
+			fprintf(stderr, "error: could not allocate the encoder queue\n");
+			return -1;
+		}
+		encoder->spare[encoder->spare_count++] = job;
+	}
+	if (encoder->format == ENCODER_FORMAT_PNG)
+		return 0;
+	if (!(encoder->file = fopen(encoder->path, "wb")))
+	{
+		fprintf(stderr, "error: could not open '%s' for writing\n", encoder->path);
+		return -1;
+	}
+	/* the frame rate is a fraction: milliframes per second keep a rate like 29.97 */
+	if (encoder->format == ENCODER_FORMAT_Y4M &&
+		fprintf(encoder->file, "YUV4MPEG2 W%d H%d F%ld:1000 Ip A1:1 C420jpeg XCOLORRANGE=LIMITED\n",
+			encoder->width, encoder->height, lround(fps * 1000.)) < 0)
+	{
+		fprintf(stderr, "error: could not write '%s'\n", encoder->path);
+		return -1;
+	}
+	return 0;
+}
+
+int		encoder_init(s_encoder* encoder, char const* path, int width, int height, double fps, int workers)
+{
+	int format = encoder_format_find(path);
+
+	memset(encoder, 0, sizeof(s_encoder));
+	if (format < 0)
+	{
+		fprintf(stderr, "error: '%s' should end in .yuv, .y4m or .png\n", path);
+		return -1;
+	}
+	if (format == ENCODER_FORMAT_PNG && !is_frame_pattern(path))
+	{
+		fprintf(stderr, "error: '%s' should hold a %%d for the frame index, like 'frame-%%05d.png'\n", path);
+		return -1;
+	}
+	if (format != ENCODER_FORMAT_PNG && (width % 2 || height % 2))
+	{
+		fprintf(stderr, "error: YUV 4:2:0 frames need an even width and height, not %dx%d\n", width, height);
+		return -1;
+	}
+	if (workers < 1 || workers > ENCODER_MAX_WORKERS)
+	{
+		fprintf(stderr, "error: the encoder needs 1 to %d threads\n", ENCODER_MAX_WORKERS);
+		return -1;
+	}
+	encoder->format = (e_encoder_format)format;
+	encoder->path = path;
+	encoder->width = width;
+	encoder->height = height;
+	encoder->job_count = (workers * 2 < ENCODER_MAX_QUEUE ? workers * 2 : ENCODER_MAX_QUEUE);
+	if (open_output(encoder, fps))
+	{
+		close_output(encoder);
+		return -1;
+	}
+	pthread_mutex_init(&encoder->lock, NULL);
+	pthread_cond_init(&encoder->queued_cond, NULL);
+	pthread_cond_init(&encoder->freed, NULL);
+	pthread_mutex_init(&encoder->write_lock, NULL);
+	pthread_cond_init(&encoder->turn, NULL);
+	for (encoder->worker_count = 0; encoder->worker_count < workers; ++encoder->worker_count)
+	{
+		if (pthread_create(&encoder->workers[encoder->worker_count], NULL, worker_run, encoder))
+		{
+			fprintf(stderr, "error: could not start the encoder threads\n");
+			encoder_free(encoder);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+int		encoder_free(s_encoder* encoder)
+{
+	int status;
+	int i;
+
+	pthread_mutex_lock(&encoder->lock);
+	while (encoder->spare_count != encoder->job_count)
+		pthread_cond_wait(&encoder->freed, &encoder->lock);
+	encoder->quit = 1;
+	pthread_cond_broadcast(&encoder->queued_cond);
+	pthread_mutex_unlock(&encoder->lock);
+	for (i = 0; i < encoder->worker_count; ++i)
+		pthread_join(encoder->workers[i], NULL);
+	pthread_mutex_destroy(&encoder->lock);
+	pthread_cond_destroy(&encoder->queued_cond);
+	pthread_cond_destroy(&encoder->freed);
+	pthread_mutex_destroy(&encoder->write_lock);
+	pthread_cond_destroy(&encoder->turn);
+	status = close_output(encoder);
+	return (atomic_load(&encoder->failed) ? -1 : status);
+}
+
+void	encoder_submit(s_encoder* encoder, uint8_t const* pixels, ptrdiff_t stride)
+{
+	size_t row = (size_t)encoder->width * 4;
+	s_encoder_job* job;
+	double start;
+	int y;
+
+	pthread_mutex_lock(&encoder->lock);
+	if (encoder->spare_count == 0)
+	{
+		/* the back-pressure: the encoders are behind */
+		++encoder->stalls;
+		start = now_ms();
+		while (encoder->spare_count == 0)
+			pthread_cond_wait(&encoder->freed, &encoder->lock);
+		encoder->stall_ms += now_ms() - start;
+	}
+	job = encoder->spare[--encoder->spare_count];
+	if (encoder->job_count - encoder->spare_count > encoder->peak)
+		encoder->peak = encoder->job_count - encoder->spare_count;
+	pthread_mutex_unlock(&encoder->lock);
+	for (y = 0; y < encoder->height; ++y)
+		memcpy(job->rgba + row * (size_t)y, pixels + stride * y, row);
+	pthread_mutex_lock(&encoder->lock);
+	job->index = encoder->submitted++;
+	encoder->queued[(encoder->queued_head + encoder->queued_count) % encoder->job_count] = job;
+	++encoder->queued_count;
+	pthread_cond_signal(&encoder->queued_cond);
+	pthread_mutex_unlock(&encoder->lock);
+}
+
+void	encoder_print(s_encoder const* encoder, FILE* file)
+{
+	fprintf(file, "encoder: %ld of %ld frames written to '%s', by %d threads (%.2f ms per frame each)\n",
+		encoder->encoded, encoder->submitted, encoder->path, encoder->worker_count,
+		encoder->encode_ms / (double)(encoder->encoded ? encoder->encoded : 1));
+	fprintf(file, "encoder: queue of %d frames, at most %d in use; %ld submissions waited for it, %.1f ms in all\n",
+		encoder->job_count, encoder->peak, encoder->stalls, encoder->stall_ms);
+}
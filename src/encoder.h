@@ -0,0 +1,122 @@
+#ifndef ENCODER_H
+#define ENCODER_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <pthread.h>
+
+/*
+**	Writes rendered frames out to files, on a pool of worker threads, for
+**	offline rendering. A frame is copied into a free buffer of a bounded queue
+**	when it is submitted, and a worker converts and writes it: to a raw I420
+**	(planar YUV 4:2:0) stream, a Y4M stream (the same, with headers), or a
+**	sequence of PNG files. The RGBA to YUV conversion uses SSE2 where it is
+**	available. The workers convert frames in parallel, but write streams in order.
+**	When every buffer of the queue is taken, submitting waits for one to be
+**	written out: this back-pressure is counted, so that it shows whether the
+**	encoders keep up with the renderer.
+*/
+
+//! The most worker threads
+#define ENCODER_MAX_WORKERS	16
+//! The most frames which can be queued (its buffers are allocated up front)
+#define ENCODER_MAX_QUEUE	32
+
+//! What frames are written as
+typedef enum encoder_format
+{
+	ENCODER_FORMAT_RAW,	//!< Raw I420 frames, one after the other, in a single file (`.yuv`)
+	ENCODER_FORMAT_Y4M,	//!< A YUV4MPEG2 stream of I420 frames (`.y4m`)
+	ENCODER_FORMAT_PNG,	//!< A PNG file per frame, from a path like `frame-%05d.png`
+	ENUMLENGTH_ENCODER_FORMAT
+}	e_encoder_format;
+
+//! A frame in the queue
+typedef struct encoder_job
+{
+	uint8_t*	rgba;		//!< The frame, tightly packed, first row at the top
+	uint8_t*	yuv;		//!< The frame once converted to I420 (`NULL` for PNG files)
+	long		index;		//!< The index of the frame among the submitted ones
+}	s_encoder_job;
+
+//! The worker threads, the queue of frames, and the back-pressure metrics
+typedef struct encoder
+{
+	e_encoder_format	format;
+	char const*			path;		//!< The file to write, or the pattern of the PNG files' paths
+	FILE*				file;		//!< The stream, for raw and Y4M
+	int					width;		//!< The size of the frames, in pixels
+	int					height;
+	pthread_t			workers[ENCODER_MAX_WORKERS];
+	int					worker_count;
+	s_encoder_job		jobs[ENCODER_MAX_QUEUE];
+	int					job_count;	//!< The size of the queue
+	s_encoder_job*		queued[ENCODER_MAX_QUEUE];	//!< The frames to encode, oldest first (a ring)
+	int					queued_head;
+	int					queued_count;
+	s_encoder_job*		spare[ENCODER_MAX_QUEUE];	//!< The buffers which can take a frame (a stack)
+	int					spare_count;
+	pthread_mutex_t		lock;		//!< Protects the queue, the metrics and `quit`
+	pthread_cond_t		queued_cond;	//!< Signaled when a frame is queued, or when the workers must quit
+	pthread_cond_t		freed;		//!< Signaled when a buffer is free again
+	pthread_mutex_t		write_lock;	//!< Protects the stream, and `written`
+	pthread_cond_t		turn;		//!< Signaled when a frame was written to the stream
+	long				written;	//!< The amount of frames which were written to the stream, in order
+	int					quit;
+	atomic_int			failed;		//!< Nonzero once a write failed: the later frames are dropped, neither converted nor written
+	long				submitted;	//!< The amount of frames which were submitted
+	long				encoded;	//!< The amount of frames which were written out
+	int					peak;		//!< The most frames which were in the queue at once
+	long				stalls;		//!< The amount of submissions which had to wait for a free buffer
+	double				stall_ms;	//!< The time which submissions spent waiting for a free buffer
+	double				encode_ms;	//!< The time which the workers spent converting and writing frames (not waiting for their turn to write)
+}	s_encoder;
+
+//! Returns the format (an `e_encoder_format`) which a file is written as, from its extension, or `-1` if it has no known one
+int		encoder_format_find(char const* path);
+
+//! Opens the output and starts the worker threads, returns `0` on success
+/*!
+**	@param encoder	The encoder to set up
+**	@param path		The file to write, in a format according to its extension: for PNG files, it
+**					is a pattern with a `%d` (like `frame-%05d.png`) which is given the frame index
+**	@param width	The size of the frames, in pixels (even, for raw and Y4M)
+**	@param height
+**	@param fps		The frame rate, which is written in the Y4M header
+**	@param workers	The amount of worker threads (at most `ENCODER_MAX_WORKERS`): the queue holds twice as many frames
+*/
+int		encoder_init(s_encoder* encoder, char const* path, int width, int height, double fps, int workers);
+//! Waits until every submitted frame is written out, stops the worker threads and closes the output
+/*!
+**	@returns
+**	`0` on success, or `-1` if a frame could not be written
+*/
+int		encoder_free(s_encoder* encoder);
+
+//! Copies a frame into the queue, for a worker to write it out
+/*!
+**	If the queue is full, this waits until a frame is written out (and counts it as a stall).
+**	@param encoder	The encoder
+**	@param pixels	The top row of the frame, in RGBA bytes
+**	@param stride	The amount of bytes from a row to the one below it (negative if the frame
+**					is stored bottom row first, as `glReadPixels()` gives it)
+*/
+void	encoder_submit(s_encoder* encoder, uint8_t const* pixels, ptrdiff_t stride);
+
+//! Prints the amount of frames written out, and the back-pressure metrics
+void	encoder_print(s_encoder const* encoder, FILE* file);
+
+//! Converts RGBA pixels to I420 (BT.601, limited range), with SSE2 where it is available
+/*!
+**	@param yuv		Receives the luma plane, then the two chroma planes at half the size
+**	@param rgba		The top row of the pixels
+**	@param stride	The amount of bytes from a row of `rgba` to the one below it
+**	@param width	The size of the frame, in pixels (even)
+**	@param height
+*/
+void	encoder_rgba_to_i420(uint8_t* yuv, uint8_t const* rgba, ptrdiff_t stride, int width, int height);
+
+#endif
@@ -1,31 +1,385 @@
 
-#include <GLFW/glfw3.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
 
-int main(void)
+#include <glad/glad.h>
+
+#include "config.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "window.h"
+#include "framestats.h"
+#include "framepacer.h"
+#include "damage.h"
+#include "readback.h"
+#include "encoder.h"
+#include "jobs.h"
+#include "render_thread.h"
+#include "scenes/scenes.h"
+#include "bench/bench.h"
+
+//! Draws the frame time graph, and shows the recent frame time percentiles in the window title
+/*!
+**	@param title_update	If nonzero, the window title is updated (this is slow on some window systems)
+*/
+static void	show_stats(s_window* window, s_framestats* stats, int title_update)
 {
-	GLFWwindow* window;
-	/* Initialize the library */
-	if (!glfwInit())
+	static s_frame_record records[FRAMESTATS_RECENT];
+	s_frame_summary summary;
+	char title[128];
+	int width, height;
+	int count;
+
+	window_framebuffer_size(window, &width, &height);
+	framestats_draw_overlay(stats, width, height);
+	if (!title_update)
+		return;
+	count = framestats_recent(stats, records, FRAMESTATS_RECENT);
+	framestats_summarize(records, (size_t)count, &summary);
+	snprintf(title, sizeof(title), "Hello World - p50 %.2f ms | p95 %.2f ms | p99 %.2f ms | hitches: %ld",
+		summary.p50_ms, summary.p95_ms, summary.p99_ms, summary.hitches);
+	window_set_title(window, title);
+}
+
+//! Hands a frame which was read back to the encoder (the frame is bottom row first)
+static void	encode_frame(void* user, s_readback_frame const* frame)
+{
+	encoder_submit((s_encoder*)user, (uint8_t const*)frame->pixels + frame->stride * (size_t)(frame->height - 1),
+		-(ptrdiff_t)frame->stride);
+}
+
+//! Starts writing the frames out to `config->output`, returns `0` on success
+static int	output_start(s_config const* config, s_window* window, s_readback* readback, s_encoder* encoder)
+{
+	int width, height;
+
+	window_framebuffer_size(window, &width, &height);
+	if (encoder_init(encoder, config->output, width, height, (config->fps > 0. ? config->fps : 60.), config->encoders))
 		return -1;
-	/* Create a windowed mode window and its OpenGL context */
-	window = glfwCreateWindow(640, 480, "Hello World", NULL, NULL);
-	if (!window)
+	/* 3 buffers: a frame is read back while the previous one is mapped, and the one before is encoded */
+	if (readback_init(readback, width, height, 3, encode_frame, encoder))
 	{
-		glfwTerminate();
+		encoder_free(encoder);
 		return -1;
 	}
-	/* Make the window's context current */
-	glfwMakeContextCurrent(window);
-	/* Loop until the user closes the window */
-	while (!glfwWindowShouldClose(window))
+	/* every frame is written out, however long it takes */
+	readback->lossless = 1;
+	return 0;
+}
+
+//! Writes out the frames which are left, and prints the encoder's metrics
+static int	output_finish(s_config const* config, s_readback* readback, s_encoder* encoder)
+{
+	int status;
+
+	readback_free(readback);
+	status = encoder_free(encoder);
+	if (config->stats)
+	{
+		encoder_print(encoder, stderr);
+		fprintf(stderr, "readback: the render thread waited %ld times\n", readback->waits);
+	}
+	return status;
+}
+
+//! Prints and/or writes out the frame timings, as asked for on the command-line
+static int	report_stats(s_config const* config, s_framestats const* stats)
+{
+	s_frame_summary summary;
+	int status = 0;
+
+	if (config->stats)
+	{
+		framestats_summarize_all(stats, &summary);
+		framestats_print(&summary, stderr);
+	}
+	if (config->stats_csv && framestats_write_csv(stats, config->stats_csv))
+	{
+		fprintf(stderr, "error: could not write '%s'\n", config->stats_csv);
+		status = -1;
+	}
+	if (config->stats_json && framestats_write_json(stats, config->stats_json))
+	{
+		fprintf(stderr, "error: could not write '%s'\n", config->stats_json);
+		status = -1;
+	}
+	return status;
+}
+
+//! A frame, as the main thread describes it to whichever thread renders it
+typedef struct frame_snapshot
+{
+	long	frame;
+	double	time;	//!< The time of the scene, in seconds
+	int		width;	//!< The size of the framebuffer, in pixels
+	int		height;
+}	s_frame_snapshot;
+
+//! What rendering frames needs, on whichever thread
+typedef struct renderer
+{
+	s_config const*	config;
+	s_window*		window;
+	s_framestats*	stats;
+	s_framepacer*	pacer;
+	s_readback*		readback;
+	s_scene const*	scene;
+	void*			scene_data;
+	s_jobs*			jobs;			//!< Which the scene shares its work out on (`NULL` without a scene)
+}	s_renderer;
+
+//! How often the main thread got to handle the window's events
+typedef struct event_gaps
+{
+	uint64_t	last;	//!< When they were last handled, in timer ticks (`0` if never)
+	uint64_t	total;
+	uint64_t	longest;
+	long		count;
+}	s_event_gaps;
+
+//! Describes the next frame: the frames which are written out are animated at their frame rate, however long they take
+static void	snapshot_frame(s_config const* config, s_window* window, long frame, s_frame_snapshot* snapshot)
+{
+	snapshot->frame = frame;
+	if (config->output)
+		snapshot->time = (double)frame / (config->fps > 0. ? config->fps : 60.);
+	else
+		snapshot->time = (double)window_timer_value() / (double)window_timer_frequency();
+	window_framebuffer_size(window, &snapshot->width, &snapshot->height);
+}
+
+//! Renders a frame, up to the swap (the window title is only updated on the main thread)
+static void	render_frame(s_renderer const* renderer, s_frame_snapshot const* snapshot, int main_thread)
+{
+	s_config const* config = renderer->config;
+
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	if (renderer->scene)
+		renderer->scene->draw(renderer->scene_data, snapshot->width, snapshot->height, snapshot->time);
+	if (config->overlay && main_thread)
+		show_stats(renderer->window, renderer->stats, config->idle || snapshot->frame % 60 == 0);
+	else if (config->overlay)
+		framestats_draw_overlay(renderer->stats, snapshot->width, snapshot->height);
+	/* Read the frame back, for the encoder */
+	if (config->output)
+		readback_capture(renderer->readback, window_framebuffer(renderer->window));
+	framestats_gpu_end(renderer->stats);
+	framestats_phase_end(renderer->stats, FRAME_PHASE_RENDER);
+}
+
+//! Renders and presents a frame on the render thread: its events phase is left empty, as they are handled on the main thread
+static void	render_threaded(void* user, void const* snapshot)
+{
+	s_renderer const* renderer = (s_renderer const*)user;
+
+	/* the scene submits its jobs from this thread now */
+	if (renderer->jobs)
+		jobs_attach(renderer->jobs);
+	framestats_frame_begin(renderer->stats);
+	framepacer_wait(renderer->pacer);
+	framestats_phase_end(renderer->stats, FRAME_PHASE_WAIT);
+	framepacer_work_begin(renderer->pacer);
+	framestats_phase_end(renderer->stats, FRAME_PHASE_EVENTS);
+	render_frame(renderer, (s_frame_snapshot const*)snapshot, 0);
+	window_swap_buffers(renderer->window);
+	framepacer_presented(renderer->pacer);
+	framestats_phase_end(renderer->stats, FRAME_PHASE_SWAP);
+	framestats_frame_end(renderer->stats);
+}
+
+//! Notes that the main thread handled the window's events
+static void	events_handled(s_event_gaps* gaps)
+{
+	uint64_t now = window_timer_value();
+
+	if (gaps->last)
+	{
+		gaps->total += now - gaps->last;
+		if (now - gaps->last > gaps->longest)
+			gaps->longest = now - gaps->last;
+		++gaps->count;
+	}
+	gaps->last = now;
+}
+
+//! Renders frames on the main thread, which handles the window's events in between
+static void	run_frames(s_renderer const* renderer, s_damage* damage, s_event_gaps* gaps)
+{
+	s_config const* config = renderer->config;
+	s_frame_snapshot snapshot;
+	long frame;
+
+	for (frame = 0; !window_should_close(renderer->window) && (config->frames == 0 || frame < config->frames); ++frame)
 	{
+		framestats_frame_begin(renderer->stats);
+		/* Wait until it is time to start the frame (or until it needs redrawing, in idle mode) */
+		if (!config->idle)
+			framepacer_wait(renderer->pacer);
+		else if (!damage_wait(damage, renderer->window))
+			break;
+		framestats_phase_end(renderer->stats, FRAME_PHASE_WAIT);
+		/* Poll for and process events */
+		window_poll_events();
+		events_handled(gaps);
+		framepacer_work_begin(renderer->pacer);
+		framestats_phase_end(renderer->stats, FRAME_PHASE_EVENTS);
 		/* Render here */
-		glClear(GL_COLOR_BUFFER_BIT);
+		snapshot_frame(config, renderer->window, frame, &snapshot);
+		render_frame(renderer, &snapshot, 1);
 		/* Swap front and back buffers */
-		glfwSwapBuffers(window);
-		/* Poll for and process events */
-		glfwPollEvents();
+		window_swap_buffers(renderer->window);
+		framepacer_presented(renderer->pacer);
+		framestats_phase_end(renderer->stats, FRAME_PHASE_SWAP);
+		/* The stats in the title are refreshed once a second, even without input */
+		if (config->idle)
+			damage_schedule(damage, window_timer_value() + window_timer_frequency());
+		framestats_frame_end(renderer->stats);
 	}
-	glfwTerminate();
+}
+
+//! Hands the frames over to a render thread, while the main thread handles the window's events, returns `0` on success
+static int	run_frames_threaded(s_renderer* renderer, s_event_gaps* gaps)
+{
+	static s_render_thread thread;
+	s_config const* config = renderer->config;
+	s_frame_snapshot* snapshot;
+	long frame = 0;
+
+	if (render_thread_start(&thread, renderer->window, sizeof(s_frame_snapshot), render_threaded, renderer))
+		return -1;
+	while (!window_should_close(renderer->window) &&
+		(config->frames == 0 || atomic_load(&thread.rendered) < config->frames))
+	{
+		/* describe the next frame as soon as the render thread took the last one: it wakes this thread up */
+		if ((config->frames == 0 || frame < config->frames) && (snapshot = (s_frame_snapshot*)render_thread_snapshot(&thread)))
+		{
+			snapshot_frame(config, renderer->window, frame++, snapshot);
+			render_thread_publish(&thread);
+		}
+		window_wait_events(0.1);
+		events_handled(gaps);
+	}
+	render_thread_stop(&thread);
 	return 0;
 }
+
+int main(int argc, char** argv)
+{
+	static s_framestats stats;
+	static s_encoder encoder;
+	static s_jobs jobs;
+	s_readback readback;
+	s_framepacer pacer;
+	s_damage damage;
+	s_config config;
+	s_window* window;
+	s_scene const* scene = NULL;
+	void* scene_data = NULL;
+	s_renderer renderer;
+	s_event_gaps gaps;
+	int status;
+	/* Read the command-line settings */
+	if (config_parse(&config, argc, argv))
+		return -1;
+	if (config.bench)
+		return bench_run(&config);
+	if (config.scene && !(scene = scene_find(config.scene)))
+		return -1;
+	/* Initialize the library */
+	if (window_init())
+		return -1;
+	/* Create a windowed mode window (or offscreen framebuffer) and its OpenGL context, hidden if the frames are written out */
+	window = window_create(config.width, config.height, "Hello World", !config.output);
+	if (!window)
+	{
+		window_terminate();
+		return -1;
+	}
+	/* Make the window's context current */
+	window_make_current(window);
+	/* Load the OpenGL functions (resolving them as they get used, if lazy) */
+	if (!window_load_gl(window, config.gl_lazy))
+	{
+		fprintf(stderr, "error: could not load the OpenGL functions\n");
+		window_destroy(window);
+		window_terminate();
+		return -1;
+	}
+	/* Find out which fast paths the driver offers */
+	gl_caps_init();
+	if (config.gl_info)
+		gl_caps_print(stderr);
+	/* Track the GL state from here on, to drop redundant changes */
+	gl_state_init();
+	/* Start the threads which share out the CPU work of each frame, then set up what to draw */
+	if (scene && jobs_init(&jobs, (config.jobs ? config.jobs : jobs_cpu_count())))
+	{
+		window_destroy(window);
+		gladUnloadGL();
+		window_terminate();
+		return -1;
+	}
+	if (scene && !(scene_data = scene->create(&config, &jobs)))
+	{
+		fprintf(stderr, "error: could not create the '%s' scene\n", scene->name);
+		jobs_free(&jobs);
+		window_destroy(window);
+		gladUnloadGL();
+		window_terminate();
+		return -1;
+	}
+	/* Measure the CPU time of each phase of every frame, and its GPU time */
+	framestats_init(&stats, gl_caps.timer_query);
+	/* Set up vsync, or the frame rate cap */
+	framepacer_init(&pacer, window, config.pacing, config.fps, config.low_latency);
+	/* In idle mode, only redraw when something changed */
+	damage_init(&damage);
+	/* Write the frames out to a file, if asked to */
+	if (config.output && output_start(&config, window, &readback, &encoder))
+	{
+		if (scene)
+		{
+			scene->destroy(scene_data);
+			jobs_free(&jobs);
+		}
+		framestats_free(&stats);
+		window_destroy(window);
+		gladUnloadGL();
+		window_terminate();
+		return -1;
+	}
+	/* Loop until the user closes the window, rendering on this thread or on a thread of its own */
+	renderer.config = &config;
+	renderer.window = window;
+	renderer.stats = &stats;
+	renderer.pacer = &pacer;
+	renderer.readback = &readback;
+	renderer.scene = scene;
+	renderer.scene_data = scene_data;
+	renderer.jobs = (scene ? &jobs : NULL);
+	memset(&gaps, 0, sizeof(s_event_gaps));
+	status = 0;
+	if (!config.render_thread)
+		run_frames(&renderer, &damage, &gaps);
+	else
+		status = run_frames_threaded(&renderer, &gaps);
+	if (config.output && output_finish(&config, &readback, &encoder))
+		status = -1;
+	if (config.stats && gaps.count)
+		fprintf(stderr, "events: handled every %.3f ms on average, %.3f ms apart at most\n",
+			(double)gaps.total * 1000. / (double)window_timer_frequency() / (double)gaps.count,
+			(double)gaps.longest * 1000. / (double)window_timer_frequency());
+	if (report_stats(&config, &stats))
+		status = -1;
+	if (scene)
+	{
+		scene->destroy(scene_data);
+		jobs_free(&jobs);
+	}
+	framestats_free(&stats);
+	window_destroy(window);
+	gladUnloadGL();
+	window_terminate();
+	return status;
+}
@@ -0,0 +1,150 @@
+
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include <glad/glad.h>
+
+#include "framepacer.h"
+
+static char const* const	pacing_names[ENUMLENGTH_PACING] =
+{
+	"uncapped",
+	"vsync",
+	"adaptive",
+	"capped",
+};
+
+int		framepacer_mode(char const* name)
+{
+	int i;
+
+	for (i = 0; i < ENUMLENGTH_PACING; ++i)
+	{
+		if (strcmp(name, pacing_names[i]) == 0)
+			return i;
+	}
+	return -1;
+}
+
+char const*	framepacer_mode_name(e_pacing mode)
+{
+	return pacing_names[mode];
+}
+
+void	sleep_until(uint64_t deadline, uint64_t spin)
+{
+	uint64_t frequency = window_timer_frequency();
+	uint64_t now = window_timer_value();
+	uint64_t remaining;
+
+	while (now + spin < deadline)
+	{
+		remaining = deadline - spin - now;
+#if defined(_WIN32)
+		Sleep((DWORD)(remaining * 1000 / frequency));
+#else
+		{
+			struct timespec duration;
+			duration.tv_sec  = (time_t)(remaining / frequency);
+			duration.tv_nsec = (long)((remaining % frequency) * 1000000000 / frequency);
+			nanosleep(&duration, NULL);
+		}
+#endif
+		now = window_timer_value();
+	}
+	while (now < deadline)
+		now = window_timer_value();
+}
+
+void	framepacer_init(s_framepacer* pacer, s_window* window, e_pacing mode, double fps, int low_latency)
+{
+	int refresh_rate = window_refresh_rate(window);
+
+	memset(pacer, 0, sizeof(s_framepacer));
+	if (mode == PACING_ADAPTIVE && !window_adaptive_sync_supported())
+	{
+		fprintf(stderr, "warning: adaptive vsync is not supported, using vsync instead\n");
+		mode = PACING_VSYNC;
+	}
+	pacer->mode = mode;
+	pacer->low_latency = low_latency;
+	pacer->frequency = window_timer_frequency();
+	if (mode == PACING_CAPPED)
+		pacer->interval = (uint64_t)((double)pacer->frequency / (fps > 0. ? fps : 60.));
+	else
+		pacer->interval = pacer->frequency / (uint64_t)(refresh_rate > 0 ? refresh_rate : 60);
+#if defined(_WIN32)
+	pacer->spin   = pacer->frequency / 500; /* Sleep() has a 1ms granularity at best */
+#else
+	pacer->spin   = pacer->frequency / 1000;
+#endif
+	pacer->margin = pacer->frequency / 1000;
+	switch (mode)
+	{
+		case PACING_VSYNC:    window_set_swap_interval(window, 1);  break;
+		case PACING_ADAPTIVE: window_set_swap_interval(window, -1); break;
+		default:              window_set_swap_interval(window, 0);  break;
+	}
+	pacer->presented = window_timer_value();
+	pacer->next_frame = pacer->presented;
+	pacer->work_start = pacer->presented;
+}
+
+void	framepacer_wait(s_framepacer* pacer)
+{
+	uint64_t now = window_timer_value();
+	uint64_t target;
+
+	switch (pacer->mode)
+	{
+		case PACING_CAPPED:
+			pacer->next_frame += pacer->interval;
+			/* more than a frame late: start over from now, rather than rushing to catch up */
+			if (pacer->next_frame + pacer->interval < now)
+				pacer->next_frame = now;
+			/* with no vertical blank to aim for, low latency only means sampling input after this wait */
+			target = pacer->next_frame;
+			break;
+		case PACING_VSYNC:
+		case PACING_ADAPTIVE:
+			if (!pacer->low_latency)
+				return;
+			/* the next vertical blank is one refresh after the last present */
+			target = pacer->presented + pacer->interval;
+			if (target < pacer->work_estimate + pacer->margin)
+				return;
+			target -= pacer->work_estimate + pacer->margin;
+			break;
+		default:
+			return;
+	}
+	sleep_until(target, pacer->spin);
+}
+
+void	framepacer_work_begin(s_framepacer* pacer)
+{
+	pacer->work_start = window_timer_value();
+}
+
+void	framepacer_presented(s_framepacer* pacer)
+{
+	uint64_t work;
+
+	/* wait for the swap to actually happen, so that the present time is the vertical blank */
+	if (pacer->low_latency && (pacer->mode == PACING_VSYNC || pacer->mode == PACING_ADAPTIVE))
+		glFinish();
+	pacer->presented = window_timer_value();
+	work = pacer->presented - pacer->work_start;
+	/* rises at once on a slow frame, decays slowly: better early than late */
+	if (work > pacer->work_estimate)
+		pacer->work_estimate = work;
+	else
+		pacer->work_estimate = (pacer->work_estimate * 15 + work) / 16;
+}
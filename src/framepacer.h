@@ -0,0 +1,63 @@
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include <stdint.h>
+
+#include "window.h"
+
+//! How frames are paced
+typedef enum pacing
+{
+	PACING_UNCAPPED,	//!< Render as fast as possible, no vsync (tearing)
+	PACING_VSYNC,		//!< Wait for the vertical blank on every swap
+	PACING_ADAPTIVE,	//!< Wait for the vertical blank, unless the frame is late (tears then, instead of stalling a whole refresh)
+	PACING_CAPPED,		//!< No vsync, frames are started at a fixed rate by the CPU
+	ENUMLENGTH_PACING
+}	e_pacing;
+
+//! Paces the main loop, according to the chosen mode
+/*!
+**	The main loop calls `framepacer_wait()` at the start of each frame, then samples input
+**	(`framepacer_work_begin()`), renders, swaps, and calls `framepacer_presented()`.
+**	In low-latency mode with vsync, the wait is stretched until just before the next vertical
+**	blank, minus the predicted time to render: input is sampled as late as possible, rather
+**	than right after the previous swap returned.
+*/
+typedef struct framepacer
+{
+	e_pacing	mode;
+	int			low_latency;	//!< If nonzero, input is sampled just before rendering
+	uint64_t	frequency;		//!< The frequency of the timer, in ticks per second
+	uint64_t	interval;		//!< The target time between frames, in ticks (the refresh period, with vsync)
+	uint64_t	next_frame;		//!< The time at which the next frame should start (capped mode)
+	uint64_t	presented;		//!< The time at which the last frame was presented
+	uint64_t	work_start;		//!< The time at which the current frame's events were sampled
+	uint64_t	work_estimate;	//!< The predicted time from sampling input to presenting, in ticks
+	uint64_t	margin;			//!< Safety margin for the low-latency wait, in ticks
+	uint64_t	spin;			//!< The last part of each wait is spent spinning, since sleeps are imprecise
+}	s_framepacer;
+
+//! Returns the pacing mode with the given name ("uncapped", "vsync", "adaptive" or "capped"), or -1
+int		framepacer_mode(char const* name);
+//! Returns the name of the given pacing mode
+char const*	framepacer_mode_name(e_pacing mode);
+
+//! Sets up the pacing of frames presented to `window` (whose context must be current)
+/*!
+**	@param mode			The pacing mode - adaptive falls back to vsync if the window system can't do it
+**	@param fps			The target frame rate of the capped mode (ignored otherwise)
+**	@param low_latency	If nonzero, input sampling is delayed until just before rendering
+*/
+void	framepacer_init(s_framepacer* pacer, s_window* window, e_pacing mode, double fps, int low_latency);
+
+//! Waits until the next frame should start (or, in low-latency mode, until its input should be sampled)
+void	framepacer_wait(s_framepacer* pacer);
+//! Marks the start of the work of a frame: when its input is sampled
+void	framepacer_work_begin(s_framepacer* pacer);
+//! Marks the end of a frame: to be called right after the swap
+void	framepacer_presented(s_framepacer* pacer);
+
+//! Waits until the timer reaches `deadline` (in ticks of `window_timer_value()`): sleeps, then spins for the last `spin` ticks
+void	sleep_until(uint64_t deadline, uint64_t spin);
+
+#endif
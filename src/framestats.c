@@ -0,0 +1,374 @@
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "framestats.h"
+#include "gl_state.h"
+#include "window.h"
+
+//! Frames which take more than this many times the median frame time are counted as hitches
+#define HITCH_FACTOR	2.
+
+static char const* const	phase_names[ENUMLENGTH_FRAME_PHASE] =
+{
+	"render",
+	"swap",
+	"events",
+	"wait",
+};
+
+int		framestats_init(s_framestats* stats, int gpu_timing)
+{
+	memset(stats, 0, sizeof(s_framestats));
+	stats->timer_frequency = window_timer_frequency();
+	if (gpu_timing)
+		glGenQueries(FRAMESTATS_QUERIES, stats->queries);
+	return 0;
+}
+
+void	framestats_free(s_framestats* stats)
+{
+	if (stats->queries[0])
+		glDeleteQueries(FRAMESTATS_QUERIES, stats->queries);
+	free(stats->history);
+	memset(stats->queries, 0, sizeof(stats->queries));
+	stats->history = NULL;
+	stats->history_size = 0;
+	stats->history_capacity = 0;
+}
+
+static float	elapsed_ms(s_framestats const* stats, uint64_t start, uint64_t end)
+{
+	return (float)((double)(end - start) * 1000. / (double)stats->timer_frequency);
+}
+
+//! Writes a record into the ring of recent frames, so that readers never see it half-written
+static void	publish(s_framestats* stats, s_frame_record const* record)
+{
+	s_frame_slot* slot = &stats->recent[record->frame % FRAMESTATS_RECENT];
+	unsigned int sequence = atomic_load_explicit(&slot->sequence, memory_order_relaxed);
+
+	atomic_store_explicit(&slot->sequence, sequence + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	slot->record = *record;
+	atomic_store_explicit(&slot->sequence, sequence + 2, memory_order_release);
+}
+
+//! Stores a GPU time which has just become available, for a frame which was recorded earlier
+static void	gpu_result(s_framestats* stats, uint64_t frame, GLuint64 nanoseconds)
+{
+	s_frame_record* record;
+
+	/* the first query of a context counts from its creation on some drivers (Mesa's llvmpipe) */
+	if (frame == 0 || frame >= stats->history_size)
+		return;
+	record = &stats->history[frame];
+	record->gpu_ms = (float)((double)nanoseconds / 1000000.);
+	if (frame + FRAMESTATS_RECENT > stats->history_size)
+		publish(stats, record);
+}
+
+//! Reads back the results of the GPU queries which are available, oldest first, without waiting
+static void	poll_queries(s_framestats* stats)
+{
+	uint64_t frame = stats->current.frame;
+	uint64_t oldest = (frame < FRAMESTATS_QUERIES ? 0 : frame - FRAMESTATS_QUERIES);
+	GLint available;
+	GLuint64 result;
+	int i;
+
+	for (; oldest < frame; ++oldest)
+	{
+		i = (int)(oldest % FRAMESTATS_QUERIES);
+		if (!stats->query_pending[i] || stats->query_frame[i] != oldest)
+			continue;
+		glGetQueryObjectiv(stats->queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			break; /* queries complete in order, so the later ones are not ready either */
+		glGetQueryObjectui64v(stats->queries[i], GL_QUERY_RESULT, &result);
+		stats->query_pending[i] = 0;
+		gpu_result(stats, oldest, result);
+	}
+}
+
+void	framestats_frame_begin(s_framestats* stats)
+{
+	int i;
+
+	stats->current.frame = stats->history_size;
+	stats->current.gpu_ms = -1.f;
+	stats->frame_start = window_timer_value();
+	stats->phase_start = stats->frame_start;
+	stats->state_calls = gl_state.calls;
+	stats->state_filtered = gl_state.filtered;
+	if (!stats->queries[0])
+		return;
+	poll_queries(stats);
+	i = (int)(stats->current.frame % FRAMESTATS_QUERIES);
+	if (stats->query_pending[i])
+		++stats->queries_dropped;
+	stats->query_frame[i] = stats->current.frame;
+	stats->query_pending[i] = 1;
+	glBeginQuery(GL_TIME_ELAPSED, stats->queries[i]);
+}
+
+void	framestats_phase_end(s_framestats* stats, e_frame_phase phase)
+{
+	uint64_t now = window_timer_value();
+	stats->current.cpu_ms[phase] += elapsed_ms(stats, stats->phase_start, now);
+	stats->phase_start = now;
+}
+
+void	framestats_gpu_end(s_framestats* stats)
+{
+	if (stats->queries[0])
+		glEndQuery(GL_TIME_ELAPSED);
+}
+
+void	framestats_frame_end(s_framestats* stats)
+{
+	s_frame_record* history;
+
+	stats->current.frame_ms = elapsed_ms(stats, stats->frame_start, window_timer_value());
+	stats->current.state_calls = (uint32_t)(gl_state.calls - stats->state_calls);
+	stats->current.state_filtered = (uint32_t)(gl_state.filtered - stats->state_filtered);
+	if (stats->history_size == stats->history_capacity)
+	{
+		size_t capacity = (stats->history_capacity ? stats->history_capacity * 2 : 1024);
+		history = (s_frame_record*)realloc(stats->history, capacity * sizeof(s_frame_record));
+		if (history == NULL)
+			return;
+		stats->history = history;
+		stats->history_capacity = capacity;
+	}
+	stats->history[stats->history_size++] = stats->current;
+	publish(stats, &stats->current);
+	atomic_store_explicit(&stats->recorded, stats->history_size, memory_order_release);
+	memset(stats->current.cpu_ms, 0, sizeof(stats->current.cpu_ms));
+}
+
+int		framestats_recent(s_framestats* stats, s_frame_record* records, int max)
+{
+	uint64_t recorded = atomic_load_explicit(&stats->recorded, memory_order_acquire);
+	uint64_t frame;
+	unsigned int before, after;
+	s_frame_slot* slot;
+	int count = 0;
+
+	if (max > FRAMESTATS_RECENT)
+		max = FRAMESTATS_RECENT;
+	frame = (recorded < (uint64_t)max ? 0 : recorded - (uint64_t)max);
+	for (; frame < recorded; ++frame)
+	{
+		slot = &stats->recent[frame % FRAMESTATS_RECENT];
+		before = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+		records[count] = slot->record;
+		atomic_thread_fence(memory_order_acquire);
+		after = atomic_load_explicit(&slot->sequence, memory_order_relaxed);
+		/* skip records which were being written, or have already been replaced */
+		if ((before & 1) || before != after || records[count].frame != frame)
+			continue;
+		++count;
+	}
+	return count;
+}
+
+static int	compare_float(void const* a, void const* b)
+{
+	float x = *(float const*)a;
+	float y = *(float const*)b;
+	return (x > y) - (x < y);
+}
+
+//! Returns the value at the given percentile of the sorted array `values` (nearest-rank)
+static double	percentile(float const* values, size_t count, double percent)
+{
+	size_t rank;
+
+	if (count == 0)
+		return 0.;
+	rank = (size_t)(percent / 100. * (double)count + 0.5);
+	if (rank > 0)
+		--rank;
+	return values[rank < count ? rank : count - 1];
+}
+
+void	framestats_summarize(s_frame_record const* records, size_t count, s_frame_summary* summary)
+{
+	float* values;
+	double total = 0.;
+	size_t gpu = 0;
+	size_t i;
+
+	memset(summary, 0, sizeof(s_frame_summary));
+	if (count == 0 || !(values = (float*)malloc(count * sizeof(float))))
+		return;
+	for (i = 0; i < count; ++i)
+	{
+		values[i] = records[i].frame_ms;
+		total += records[i].frame_ms;
+		summary->state_calls += records[i].state_calls;
+		summary->state_filtered += records[i].state_filtered;
+	}
+	summary->state_calls /= (double)count;
+	summary->state_filtered /= (double)count;
+	qsort(values, count, sizeof(float), compare_float);
+	summary->frames  = (long)count;
+	summary->mean_ms = total / (double)count;
+	summary->p50_ms  = percentile(values, count, 50.);
+	summary->p95_ms  = percentile(values, count, 95.);
+	summary->p99_ms  = percentile(values, count, 99.);
+	summary->max_ms  = values[count - 1];
+	for (i = 0; i < count; ++i)
+	{
+		if (records[i].frame_ms > HITCH_FACTOR * summary->p50_ms)
+			++summary->hitches;
+		if (records[i].gpu_ms >= 0.f)
+			values[gpu++] = records[i].gpu_ms;
+	}
+	qsort(values, gpu, sizeof(float), compare_float);
+	summary->gpu_frames = (long)gpu;
+	summary->gpu_p50_ms = percentile(values, gpu, 50.);
+	summary->gpu_p95_ms = percentile(values, gpu, 95.);
+	summary->gpu_p99_ms = percentile(values, gpu, 99.);
+	free(values);
+}
+
+void	framestats_summarize_all(s_framestats const* stats, s_frame_summary* summary)
+{
+	framestats_summarize(stats->history, stats->history_size, summary);
+}
+
+void	framestats_print(s_frame_summary const* summary, FILE* stream)
+{
+	fprintf(stream, "frames: %ld | frame time: mean %.3f ms, p50 %.3f ms, p95 %.3f ms, p99 %.3f ms, max %.3f ms | hitches: %ld",
+		summary->frames,
+		summary->mean_ms,
+		summary->p50_ms,
+		summary->p95_ms,
+		summary->p99_ms,
+		summary->max_ms,
+		summary->hitches);
+	if (summary->gpu_frames)
+		fprintf(stream, " | GPU time: p50 %.3f ms, p95 %.3f ms, p99 %.3f ms",
+			summary->gpu_p50_ms,
+			summary->gpu_p95_ms,
+			summary->gpu_p99_ms);
+	if (summary->state_calls > 0.)
+		fprintf(stream, " | GL state changes: %.1f/frame, %.1f redundant (%.0f%%)",
+			summary->state_calls,
+			summary->state_filtered,
+			summary->state_filtered * 100. / summary->state_calls);
+	fprintf(stream, "\n");
+}
+
+void	framestats_draw_overlay(s_framestats* stats, int width, int height)
+{
+	static GLfloat const	green[4]  = { 0.2f, 0.9f, 0.2f, 1.f };
+	static GLfloat const	yellow[4] = { 0.9f, 0.8f, 0.1f, 1.f };
+	static GLfloat const	red[4]    = { 1.0f, 0.1f, 0.1f, 1.f };
+	static GLfloat const	white[4]  = { 1.0f, 1.0f, 1.0f, 1.f };
+	static s_frame_record	records[FRAMESTATS_RECENT];
+	s_frame_summary summary;
+	GLfloat const* color;
+	int graph_height = height / 4;
+	int bar_height;
+	int count;
+	int i;
+
+	/* one 2-pixel bar per frame, the full graph height is 2 frames at 60Hz */
+	count = framestats_recent(stats, records, width / 2);
+	framestats_summarize(records, (size_t)count, &summary);
+	gl_state_enable(GL_SCISSOR_TEST, 1);
+	for (i = 0; i < count; ++i)
+	{
+		bar_height = (int)(records[i].frame_ms / (2000.f / 60.f) * (float)graph_height);
+		if (bar_height < 1)
+			bar_height = 1;
+		if (bar_height > graph_height)
+			bar_height = graph_height;
+		if (records[i].frame_ms > HITCH_FACTOR * summary.p50_ms)
+			color = red;
+		else if (records[i].frame_ms > 1000.f / 60.f)
+			color = yellow;
+		else
+			color = green;
+		gl_state_scissor(i * 2, 0, 2, bar_height);
+		glClearBufferfv(GL_COLOR, 0, color);
+	}
+	/* the 60Hz frame budget */
+	gl_state_scissor(0, graph_height / 2, count * 2, 1);
+	glClearBufferfv(GL_COLOR, 0, white);
+	gl_state_enable(GL_SCISSOR_TEST, 0);
+}
+
+int		framestats_write_csv(s_framestats const* stats, char const* path)
+{
+	FILE* file = fopen(path, "w");
+	s_frame_record const* record;
+	size_t i;
+	int phase;
+
+	if (!file)
+		return -1;
+	fprintf(file, "frame");
+	for (phase = 0; phase < ENUMLENGTH_FRAME_PHASE; ++phase)
+		fprintf(file, ",%s_ms", phase_names[phase]);
+	fprintf(file, ",frame_ms,gpu_ms,state_calls,state_filtered\n");
+	for (i = 0; i < stats->history_size; ++i)
+	{
+		record = &stats->history[i];
+		fprintf(file, "%llu", (unsigned long long)record->frame);
+		for (phase = 0; phase < ENUMLENGTH_FRAME_PHASE; ++phase)
+			fprintf(file, ",%.4f", record->cpu_ms[phase]);
+		fprintf(file, ",%.4f,", record->frame_ms);
+		if (record->gpu_ms >= 0.f)
+			fprintf(file, "%.4f", record->gpu_ms);
+		fprintf(file, ",%u,%u\n", record->state_calls, record->state_filtered);
+	}
+	return (fclose(file) == 0 ? 0 : -1);
+}
+
+int		framestats_write_json(s_framestats const* stats, char const* path)
+{
+	FILE* file = fopen(path, "w");
+	s_frame_summary summary;
+	s_frame_record const* record;
+	size_t i;
+	int phase;
+
+	if (!file)
+		return -1;
+	framestats_summarize_all(stats, &summary);
+	fprintf(file, "{\n\t\"summary\": {\n");
+	fprintf(file, "\t\t\"frames\": %ld,\n", summary.frames);
+	fprintf(file, "\t\t\"hitches\": %ld,\n", summary.hitches);
+	fprintf(file, "\t\t\"mean_ms\": %.4f,\n", summary.mean_ms);
+	fprintf(file, "\t\t\"p50_ms\": %.4f,\n", summary.p50_ms);
+	fprintf(file, "\t\t\"p95_ms\": %.4f,\n", summary.p95_ms);
+	fprintf(file, "\t\t\"p99_ms\": %.4f,\n", summary.p99_ms);
+	fprintf(file, "\t\t\"max_ms\": %.4f,\n", summary.max_ms);
+	fprintf(file, "\t\t\"gpu_frames\": %ld,\n", summary.gpu_frames);
+	fprintf(file, "\t\t\"gpu_p50_ms\": %.4f,\n", summary.gpu_p50_ms);
+	fprintf(file, "\t\t\"gpu_p95_ms\": %.4f,\n", summary.gpu_p95_ms);
+	fprintf(file, "\t\t\"gpu_p99_ms\": %.4f,\n", summary.gpu_p99_ms);
+	fprintf(file, "\t\t\"gpu_queries_dropped\": %ld,\n", stats->queries_dropped);
+	fprintf(file, "\t\t\"state_calls\": %.2f,\n", summary.state_calls);
+	fprintf(file, "\t\t\"state_filtered\": %.2f\n", summary.state_filtered);
+	fprintf(file, "\t},\n\t\"frames\": [");
+	for (i = 0; i < stats->history_size; ++i)
+	{
+		record = &stats->history[i];
+		fprintf(file, "%s\n\t\t{ \"frame\": %llu", (i ? "," : ""), (unsigned long long)record->frame);
+		for (phase = 0; phase < ENUMLENGTH_FRAME_PHASE; ++phase)
+			fprintf(file, ", \"%s_ms\": %.4f", phase_names[phase], record->cpu_ms[phase]);
+		fprintf(file, ", \"frame_ms\": %.4f", record->frame_ms);
+		if (record->gpu_ms >= 0.f)
+			fprintf(file, ", \"gpu_ms\": %.4f", record->gpu_ms);
+		else
+			fprintf(file, ", \"gpu_ms\": null");
+		fprintf(file, ", \"state_calls\": %u, \"state_filtered\": %u }", record->state_calls, record->state_filtered);
+	}
+	fprintf(file, "\n\t]\n}\n");
+	return (fclose(file) == 0 ? 0 : -1);
+}
@@ -0,0 +1,121 @@
+#ifndef FRAMESTATS_H
+#define FRAMESTATS_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <glad/glad.h>
+
+//! The phases of a frame which are timed on the CPU
+typedef enum frame_phase
+{
+	FRAME_PHASE_RENDER,	//!< Issuing the GL calls for the frame
+	FRAME_PHASE_SWAP,	//!< Presenting the frame (`window_swap_buffers()`)
+	FRAME_PHASE_EVENTS,	//!< Processing window events (`window_poll_events()`)
+	FRAME_PHASE_WAIT,	//!< Waiting for the next frame, as paced by `framepacer_wait()`
+	ENUMLENGTH_FRAME_PHASE
+}	e_frame_phase;
+
+//! The timings measured for one frame
+typedef struct frame_record
+{
+	uint64_t	frame;		//!< The index of this frame, counting from 0
+	float		cpu_ms[ENUMLENGTH_FRAME_PHASE];	//!< The CPU time spent in each phase, in milliseconds
+	float		frame_ms;	//!< The CPU time of the whole frame, in milliseconds
+	float		gpu_ms;		//!< The GPU time of the frame, in milliseconds (negative if unknown)
+	uint32_t	state_calls;	//!< The amount of GL state changes asked for through `gl_state`
+	uint32_t	state_filtered;	//!< The amount of those which were redundant, and dropped
+}	s_frame_record;
+
+//! The distribution of frame times over a set of frames
+typedef struct frame_summary
+{
+	long	frames;		//!< The amount of frames which were summarized
+	long	hitches;	//!< The amount of frames which took more than twice the median frame time
+	double	mean_ms;
+	double	p50_ms;
+	double	p95_ms;
+	double	p99_ms;
+	double	max_ms;
+	long	gpu_frames;	//!< The amount of frames for which the GPU time is known
+	double	gpu_p50_ms;
+	double	gpu_p95_ms;
+	double	gpu_p99_ms;
+	double	state_calls;	//!< The mean amount of GL state changes per frame
+	double	state_filtered;	//!< The mean amount of redundant GL state changes dropped per frame
+}	s_frame_summary;
+
+//! The amount of recent frames which can be read concurrently with `framestats_recent()`
+#define FRAMESTATS_RECENT	512
+//! The amount of GPU timer queries in flight: results are read this many frames late, so readback never stalls
+#define FRAMESTATS_QUERIES	8
+
+//! A slot of the lock-free buffer of recent frames, guarded by a sequence counter
+typedef struct frame_slot
+{
+	atomic_uint		sequence;	//!< Odd while the record is being written
+	s_frame_record	record;
+}	s_frame_slot;
+
+//! Frame time instrumentation: CPU timings for each phase, and GPU timings from timer queries
+/*!
+**	Frames are recorded by the thread which renders them. Any thread can read
+**	the most recent frames at the same time, without locking, through `framestats_recent()`.
+*/
+typedef struct framestats
+{
+	s_frame_slot	recent[FRAMESTATS_RECENT];	//!< The ring of recent frames, for concurrent readers
+	atomic_ulong	recorded;	//!< The amount of frames written to `recent` so far
+	s_frame_record*	history;	//!< Every frame recorded so far, for the final report (render thread only)
+	size_t			history_size;
+	size_t			history_capacity;
+	s_frame_record	current;	//!< The frame being measured
+	uint64_t		frame_start;
+	uint64_t		phase_start;
+	long			state_calls;	//!< The `gl_state` call counters at the start of the frame
+	long			state_filtered;
+	uint64_t		timer_frequency;
+	GLuint			queries[FRAMESTATS_QUERIES];	//!< The ring of `GL_TIME_ELAPSED` queries (all 0 if GPU timing is off)
+	uint64_t		query_frame[FRAMESTATS_QUERIES];	//!< The frame measured by each query
+	int				query_pending[FRAMESTATS_QUERIES];
+	long			queries_dropped;	//!< The amount of GPU results which never became available in time
+}	s_framestats;
+
+//! Sets up frame time measurement, with GPU timing if `gpu_timing` is nonzero (needs a current GL context)
+int		framestats_init(s_framestats* stats, int gpu_timing);
+//! Frees the recorded history and the GPU queries
+void	framestats_free(s_framestats* stats);
+
+//! Marks the start of a frame, and of its first phase
+void	framestats_frame_begin(s_framestats* stats);
+//! Marks the end of the given phase (and the start of the next one) - the time of a phase which happens several times in a frame adds up
+void	framestats_phase_end(s_framestats* stats, e_frame_phase phase);
+//! Marks the end of the GPU work of the frame: must be called before the swap
+void	framestats_gpu_end(s_framestats* stats);
+//! Marks the end of the frame, and records it
+void	framestats_frame_end(s_framestats* stats);
+
+//! Copies the most recent frames (oldest first) into `records`, can be called from any thread
+/*!
+**	@returns
+**	The amount of records copied, at most `max` (and at most `FRAMESTATS_RECENT`)
+*/
+int		framestats_recent(s_framestats* stats, s_frame_record* records, int max);
+
+//! Computes the distribution of frame times over the given records
+void	framestats_summarize(s_frame_record const* records, size_t count, s_frame_summary* summary);
+//! Computes the distribution of frame times over every frame recorded so far
+void	framestats_summarize_all(s_framestats const* stats, s_frame_summary* summary);
+//! Prints a one-line summary to `stream`
+void	framestats_print(s_frame_summary const* summary, FILE* stream);
+
+//! Draws a graph of the recent frame times over the bottom-left of the current framebuffer
+void	framestats_draw_overlay(s_framestats* stats, int width, int height);
+
+//! Writes every recorded frame to a CSV file, returns `0` on success
+int		framestats_write_csv(s_framestats const* stats, char const* path);
+//! Writes the summary and every recorded frame to a JSON file, returns `0` on success
+int		framestats_write_json(s_framestats const* stats, char const* path);
+
+#endif
@@ -0,0 +1,64 @@
+
+#include "gl_caps.h"
+
+s_gl_caps	gl_caps;
+
+//! Returns nonzero if the context version is at least `major`.`minor`
+static int	gl_version(int major, int minor)
+{
+	return (GLVersion.major > major || (GLVersion.major == major && GLVersion.minor >= minor));
+}
+
+void	gl_caps_init(void)
+{
+	GLint formats = 0;
+
+	gl_caps.buffer_storage          = gl_version(4, 4) || GLAD_GL_ARB_buffer_storage;
+	gl_caps.multi_draw_indirect     = gl_version(4, 3) || GLAD_GL_ARB_multi_draw_indirect;
+	gl_caps.base_instance           = gl_version(4, 2) || GLAD_GL_ARB_base_instance;
+	gl_caps.direct_state_access     = gl_version(4, 5) || GLAD_GL_ARB_direct_state_access;
+	gl_caps.texture_storage         = gl_version(4, 2) || GLAD_GL_ARB_texture_storage;
+	gl_caps.program_binary          = gl_version(4, 1) || GLAD_GL_ARB_get_program_binary;
+	gl_caps.parallel_shader_compile = GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile;
+	gl_caps.timer_query             = gl_version(3, 3);
+	gl_caps.debug_output            = gl_version(4, 3) || GLAD_GL_KHR_debug;
+	gl_caps.texture_compression_bptc = gl_version(4, 2) || GLAD_GL_ARB_texture_compression_bptc;
+	gl_caps.texture_compression_s3tc = GLAD_GL_EXT_texture_compression_s3tc;
+	gl_caps.texture_compression_etc2 = gl_version(4, 3) || GLAD_GL_ARB_ES3_compatibility;
+	/* a driver may support program binaries while accepting no format at all */
+	if (gl_caps.program_binary)
+	{
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+		gl_caps.program_binary = (formats > 0);
+	}
+	gl_caps.uniform_buffer_offset_alignment = 256;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &gl_caps.uniform_buffer_offset_alignment);
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &gl_caps.max_texture_size);
+}
+
+static char const*	yes_no(int value)
+{
+	return (value ? "yes" : "no");
+}
+
+void	gl_caps_print(FILE* stream)
+{
+	fprintf(stream, "GL_VENDOR:   %s\n", (char const*)glGetString(GL_VENDOR));
+	fprintf(stream, "GL_RENDERER: %s\n", (char const*)glGetString(GL_RENDERER));
+	fprintf(stream, "GL_VERSION:  %s\n", (char const*)glGetString(GL_VERSION));
+	fprintf(stream, "fast paths:\n");
+	fprintf(stream, "  persistent mapped buffers (buffer storage): %s\n", yes_no(gl_caps.buffer_storage));
+	fprintf(stream, "  multi-draw indirect:                        %s\n", yes_no(gl_caps.multi_draw_indirect));
+	fprintf(stream, "  indirect draws with base instance:          %s\n", yes_no(gl_caps.base_instance));
+	fprintf(stream, "  direct state access:                        %s\n", yes_no(gl_caps.direct_state_access));
+	fprintf(stream, "  immutable texture storage:                  %s\n", yes_no(gl_caps.texture_storage));
+	fprintf(stream, "  program binaries:                           %s\n", yes_no(gl_caps.program_binary));
+	fprintf(stream, "  parallel shader compile:                    %s\n", yes_no(gl_caps.parallel_shader_compile));
+	fprintf(stream, "  GPU timer queries:                          %s\n", yes_no(gl_caps.timer_query));
+	fprintf(stream, "  debug output:                               %s\n", yes_no(gl_caps.debug_output));
+	fprintf(stream, "texture compression: BC1-3 %s, BC6H/BC7 %s, ETC2 %s\n",
+		yes_no(gl_caps.texture_compression_s3tc),
+		yes_no(gl_caps.texture_compression_bptc),
+		yes_no(gl_caps.texture_compression_etc2));
+	fprintf(stream, "uniform buffer offset alignment: %d bytes\n", gl_caps.uniform_buffer_offset_alignment);
+}
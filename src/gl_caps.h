@@ -0,0 +1,41 @@
+#ifndef GL_CAPS_H
+#define GL_CAPS_H
+
+#include <stdio.h>
+
+#include <glad/glad.h>
+
+//! The optional fast paths which the current OpenGL context supports
+/*!
+**	Each of these is available either from the core version which introduced it,
+**	or from the ARB/KHR extension, on older drivers which expose it that way.
+**	The renderer checks these, rather than the GL version, to choose how to submit work.
+*/
+typedef struct gl_caps
+{
+	int		buffer_storage;			//!< `glBufferStorage()`, for persistent/coherent mapped buffers (4.4, ARB_buffer_storage)
+	int		multi_draw_indirect;	//!< `glMultiDraw*Indirect()` (4.3, ARB_multi_draw_indirect)
+	int		base_instance;			//!< The `baseInstance` field of indirect draw commands is honored (4.2, ARB_base_instance)
+	int		direct_state_access;	//!< `glCreate*()`, `glNamed*()`, `glTexture*()` (4.5, ARB_direct_state_access)
+	int		texture_storage;		//!< `glTexStorage*()` (4.2, ARB_texture_storage)
+	int		program_binary;			//!< `glGetProgramBinary()`/`glProgramBinary()`, with at least one binary format (4.1, ARB_get_program_binary)
+	int		parallel_shader_compile;//!< `GL_COMPLETION_STATUS_KHR` queries (KHR/ARB_parallel_shader_compile)
+	int		timer_query;			//!< `GL_TIME_ELAPSED` queries (3.3)
+	int		debug_output;			//!< `glDebugMessageCallback()` (4.3, KHR_debug)
+	int		texture_compression_bptc;	//!< BC6H/BC7 texture formats (4.2, ARB_texture_compression_bptc)
+	int		texture_compression_s3tc;	//!< BC1-BC3 texture formats (EXT_texture_compression_s3tc)
+	int		texture_compression_etc2;	//!< ETC2/EAC texture formats (4.3, ARB_ES3_compatibility)
+	GLint	uniform_buffer_offset_alignment;	//!< The alignment required for `glBindBufferRange(GL_UNIFORM_BUFFER, ...)` offsets
+	GLint	max_texture_size;		//!< The largest width/height allowed for a 2D texture
+}	s_gl_caps;
+
+//! The capabilities of the current context, filled in by `gl_caps_init()`
+extern s_gl_caps	gl_caps;
+
+//! Fills in `gl_caps`, must be called after the GL functions have been loaded
+void	gl_caps_init(void);
+
+//! Prints the GL driver strings and which fast paths are available to `stream`
+void	gl_caps_print(FILE* stream);
+
+#endif
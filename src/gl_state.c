@@ -0,0 +1,305 @@
+
+#include <string.h>
+
+#include "gl_state.h"
+
+s_gl_state	gl_state;
+
+static GLenum const	buffer_targets[ENUMLENGTH_GL_STATE_BUFFER] =
+{
+	GL_ARRAY_BUFFER,
+	GL_ELEMENT_ARRAY_BUFFER,
+	GL_COPY_READ_BUFFER,
+	GL_COPY_WRITE_BUFFER,
+	GL_PIXEL_PACK_BUFFER,
+	GL_PIXEL_UNPACK_BUFFER,
+	GL_UNIFORM_BUFFER,
+	GL_TEXTURE_BUFFER,
+	GL_DRAW_INDIRECT_BUFFER,
+};
+
+static GLenum const	texture_targets[ENUMLENGTH_GL_STATE_TEXTURE] =
+{
+	GL_TEXTURE_2D,
+	GL_TEXTURE_2D_ARRAY,
+	GL_TEXTURE_3D,
+	GL_TEXTURE_CUBE_MAP,
+	GL_TEXTURE_BUFFER,
+};
+
+static GLenum const	capabilities[ENUMLENGTH_GL_STATE_CAPABILITY] =
+{
+	GL_BLEND,
+	GL_CULL_FACE,
+	GL_DEPTH_TEST,
+	GL_SCISSOR_TEST,
+	GL_STENCIL_TEST,
+	GL_POLYGON_OFFSET_FILL,
+	GL_FRAMEBUFFER_SRGB,
+	GL_PRIMITIVE_RESTART,
+};
+
+//! Returns the index of `value` in `values`, or `-1` if it is not tracked
+static int	find(GLenum const* values, int count, GLenum value)
+{
+	int i;
+
+	for (i = 0; i < count; ++i)
+	{
+		if (values[i] == value)
+			return i;
+	}
+	return -1;
+}
+
+//! Counts a state change, and returns nonzero if it needs to go through (sets `*current` to `value` if so)
+static int	change(GLuint* current, GLuint value)
+{
+	++gl_state.calls;
+	if (*current == value)
+	{
+		++gl_state.filtered;
+		return 0;
+	}
+	*current = value;
+	return 1;
+}
+
+void	gl_state_init(void)
+{
+	gl_state_invalidate();
+	gl_state.calls = 0;
+	gl_state.filtered = 0;
+}
+
+void	gl_state_invalidate(void)
+{
+	long calls = gl_state.calls;
+	long filtered = gl_state.filtered;
+
+	/* every byte 0xFF: all names and enable bits are GL_STATE_UNKNOWN */
+	memset(&gl_state, 0xFF, sizeof(s_gl_state));
+	gl_state.viewport_known = 0;
+	gl_state.scissor_known = 0;
+	gl_state.calls = calls;
+	gl_state.filtered = filtered;
+}
+
+void	gl_state_use_program(GLuint program)
+{
+	if (change(&gl_state.program, program))
+		glUseProgram(program);
+}
+
+void	gl_state_bind_vertex_array(GLuint vertex_array)
+{
+	if (change(&gl_state.vertex_array, vertex_array))
+	{
+		glBindVertexArray(vertex_array);
+		gl_state.buffers[GL_STATE_BUFFER_ELEMENT_ARRAY] = GL_STATE_UNKNOWN;
+	}
+}
+
+void	gl_state_bind_framebuffer(GLenum target, GLuint framebuffer)
+{
+	int draw = (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER);
+	int read = (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER);
+
+	++gl_state.calls;
+	if ((!draw || gl_state.draw_framebuffer == framebuffer) &&
+		(!read || gl_state.read_framebuffer == framebuffer))
+	{
+		++gl_state.filtered;
+		return;
+	}
+	if (draw)
+		gl_state.draw_framebuffer = framebuffer;
+	if (read)
+		gl_state.read_framebuffer = framebuffer;
+	glBindFramebuffer(target, framebuffer);
+}
+
+void	gl_state_bind_buffer(GLenum target, GLuint buffer)
+{
+	int index = find(buffer_targets, ENUMLENGTH_GL_STATE_BUFFER, target);
+
+	if (index < 0)
+		glBindBuffer(target, buffer);
+	else if (change(&gl_state.buffers[index], buffer))
+		glBindBuffer(target, buffer);
+}
+
+void	gl_state_bind_buffer_range(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	int generic = find(buffer_targets, ENUMLENGTH_GL_STATE_BUFFER, target);
+
+	if (target == GL_UNIFORM_BUFFER && index < GL_STATE_UNIFORM_BINDINGS)
+	{
+		++gl_state.calls;
+		if (gl_state.uniform_buffers[index] == buffer &&
+			gl_state.uniform_offsets[index] == offset && gl_state.uniform_sizes[index] == size)
+		{
+			++gl_state.filtered;
+			return;
+		}
+		gl_state.uniform_buffers[index] = buffer;
+		gl_state.uniform_offsets[index] = offset;
+		gl_state.uniform_sizes[index] = size;
+	}
+	/* an indexed bind also binds the buffer to the generic binding point */
+	if (generic >= 0)
+		gl_state.buffers[generic] = buffer;
+	glBindBufferRange(target, index, buffer, offset, size);
+}
+
+void	gl_state_bind_texture(GLuint unit, GLenum target, GLuint texture)
+{
+	int index = find(texture_targets, ENUMLENGTH_GL_STATE_TEXTURE, target);
+
+	if (index < 0 || unit >= GL_STATE_TEXTURE_UNITS)
+	{
+		gl_state.active_texture = unit;
+		glActiveTexture(GL_TEXTURE0 + unit);
+		glBindTexture(target, texture);
+	}
+	else if (change(&gl_state.textures[unit][index], texture))
+	{
+		/* the active unit is only selector state: it only matters when something gets bound */
+		if (gl_state.active_texture != unit)
+		{
+			gl_state.active_texture = unit;
+			glActiveTexture(GL_TEXTURE0 + unit);
+		}
+		glBindTexture(target, texture);
+	}
+}
+
+void	gl_state_enable(GLenum capability, int enable)
+{
+	int index = find(capabilities, ENUMLENGTH_GL_STATE_CAPABILITY, capability);
+	GLuint value = (enable ? GL_TRUE : GL_FALSE);
+
+	if (index >= 0 && !change(&gl_state.enabled[index], value))
+		return;
+	if (enable)
+		glEnable(capability);
+	else
+		glDisable(capability);
+}
+
+void	gl_state_blend_func(GLenum source, GLenum destination)
+{
+	++gl_state.calls;
+	if (gl_state.blend_func[0] == source && gl_state.blend_func[1] == destination)
+	{
+		++gl_state.filtered;
+		return;
+	}
+	gl_state.blend_func[0] = source;
+	gl_state.blend_func[1] = destination;
+	glBlendFunc(source, destination);
+}
+
+void	gl_state_viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	GLint const viewport[4] = { x, y, width, height };
+
+	++gl_state.calls;
+	if (gl_state.viewport_known && memcmp(gl_state.viewport, viewport, sizeof(viewport)) == 0)
+	{
+		++gl_state.filtered;
+		return;
+	}
+	memcpy(gl_state.viewport, viewport, sizeof(viewport));
+	gl_state.viewport_known = 1;
+	glViewport(x, y, width, height);
+}
+
+void	gl_state_scissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	GLint const scissor[4] = { x, y, width, height };
+
+	++gl_state.calls;
+	if (gl_state.scissor_known && memcmp(gl_state.scissor, scissor, sizeof(scissor)) == 0)
+	{
+		++gl_state.filtered;
+		return;
+	}
+	memcpy(gl_state.scissor, scissor, sizeof(scissor));
+	gl_state.scissor_known = 1;
+	glScissor(x, y, width, height);
+}
+
+/*
+**	Deleting a bound object unbinds it, in GL: the name may then be reused by a
+**	new object, which must not be taken for being bound already.
+*/
+
+void	gl_state_delete_buffers(GLsizei count, GLuint const* buffers)
+{
+	GLsizei i;
+	int b;
+
+	for (i = 0; i < count; ++i)
+	{
+		for (b = 0; b < ENUMLENGTH_GL_STATE_BUFFER; ++b)
+		{
+			if (gl_state.buffers[b] == buffers[i])
+				gl_state.buffers[b] = 0;
+		}
+		for (b = 0; b < GL_STATE_UNIFORM_BINDINGS; ++b)
+		{
+			if (gl_state.uniform_buffers[b] == buffers[i])
+				gl_state.uniform_buffers[b] = 0;
+		}
+	}
+	glDeleteBuffers(count, buffers);
+}
+
+void	gl_state_delete_textures(GLsizei count, GLuint const* textures)
+{
+	GLsizei i;
+	int unit, t;
+
+	for (i = 0; i < count; ++i)
+	{
+		for (unit = 0; unit < GL_STATE_TEXTURE_UNITS; ++unit)
+		{
+			for (t = 0; t < ENUMLENGTH_GL_STATE_TEXTURE; ++t)
+			{
+				if (gl_state.textures[unit][t] == textures[i])
+					gl_state.textures[unit][t] = 0;
+			}
+		}
+	}
+	glDeleteTextures(count, textures);
+}
+
+void	gl_state_delete_vertex_arrays(GLsizei count, GLuint const* vertex_arrays)
+{
+	GLsizei i;
+
+	for (i = 0; i < count; ++i)
+	{
+		if (gl_state.vertex_array == vertex_arrays[i])
+		{
+			gl_state.vertex_array = 0;
+			gl_state.buffers[GL_STATE_BUFFER_ELEMENT_ARRAY] = GL_STATE_UNKNOWN;
+		}
+	}
+	glDeleteVertexArrays(count, vertex_arrays);
+}
+
+void	gl_state_delete_framebuffers(GLsizei count, GLuint const* framebuffers)
+{
+	GLsizei i;
+
+	for (i = 0; i < count; ++i)
+	{
+		if (gl_state.draw_framebuffer == framebuffers[i])
+			gl_state.draw_framebuffer = 0;
+		if (gl_state.read_framebuffer == framebuffers[i])
+			gl_state.read_framebuffer = 0;
+	}
+	glDeleteFramebuffers(count, framebuffers);
+}
@@ -0,0 +1,125 @@
+#ifndef GL_STATE_H
+#define GL_STATE_H
+
+#include <glad/glad.h>
+
+/*
+**	A shadow copy of the GL state which the renderer changes most often:
+**	bound objects, enable bits, viewport/scissor and the textures bound to
+**	each unit. Changes which would set a value that is already current are
+**	dropped before they reach the driver (which would validate them all the
+**	same), and counted. State which is changed behind this layer's back (by
+**	direct GL calls, another library, or a context switch) must be forgotten
+**	with `gl_state_invalidate()`.
+**	Nothing is reset to its default after use: code which goes through this
+**	layer sets all of the state its draws depend on, every time.
+*/
+
+//! The amount of texture units whose bindings are tracked
+#define GL_STATE_TEXTURE_UNITS	16
+
+//! The amount of uniform buffer binding points whose ranges are tracked
+#define GL_STATE_UNIFORM_BINDINGS	16
+
+//! A value which is never a valid object name or state: the next change always goes through
+#define GL_STATE_UNKNOWN	0xFFFFFFFFu
+
+//! The buffer binding points which are tracked (the element array buffer is part of the vertex array state)
+typedef enum gl_state_buffer
+{
+	GL_STATE_BUFFER_ARRAY,
+	GL_STATE_BUFFER_ELEMENT_ARRAY,
+	GL_STATE_BUFFER_COPY_READ,
+	GL_STATE_BUFFER_COPY_WRITE,
+	GL_STATE_BUFFER_PIXEL_PACK,
+	GL_STATE_BUFFER_PIXEL_UNPACK,
+	GL_STATE_BUFFER_UNIFORM,
+	GL_STATE_BUFFER_TEXTURE,
+	GL_STATE_BUFFER_DRAW_INDIRECT,
+	ENUMLENGTH_GL_STATE_BUFFER
+}	e_gl_state_buffer;
+
+//! The texture targets which are tracked, on each unit
+typedef enum gl_state_texture
+{
+	GL_STATE_TEXTURE_2D,
+	GL_STATE_TEXTURE_2D_ARRAY,
+	GL_STATE_TEXTURE_3D,
+	GL_STATE_TEXTURE_CUBE_MAP,
+	GL_STATE_TEXTURE_BUFFER,
+	ENUMLENGTH_GL_STATE_TEXTURE
+}	e_gl_state_texture;
+
+//! The capabilities whose enable bit is tracked
+typedef enum gl_state_capability
+{
+	GL_STATE_BLEND,
+	GL_STATE_CULL_FACE,
+	GL_STATE_DEPTH_TEST,
+	GL_STATE_SCISSOR_TEST,
+	GL_STATE_STENCIL_TEST,
+	GL_STATE_POLYGON_OFFSET_FILL,
+	GL_STATE_FRAMEBUFFER_SRGB,
+	GL_STATE_PRIMITIVE_RESTART,
+	ENUMLENGTH_GL_STATE_CAPABILITY
+}	e_gl_state_capability;
+
+//! The shadow copy of the state of the current context
+typedef struct gl_state
+{
+	GLuint	program;
+	GLuint	vertex_array;
+	GLuint	draw_framebuffer;
+	GLuint	read_framebuffer;
+	GLuint	buffers[ENUMLENGTH_GL_STATE_BUFFER];
+	GLuint	uniform_buffers[GL_STATE_UNIFORM_BINDINGS];	//!< The buffer bound to each indexed uniform buffer binding point
+	GLintptr	uniform_offsets[GL_STATE_UNIFORM_BINDINGS];
+	GLsizeiptr	uniform_sizes[GL_STATE_UNIFORM_BINDINGS];
+	GLuint	active_texture;	//!< The active texture unit, from 0
+	GLuint	textures[GL_STATE_TEXTURE_UNITS][ENUMLENGTH_GL_STATE_TEXTURE];
+	GLuint	enabled[ENUMLENGTH_GL_STATE_CAPABILITY];	//!< `GL_TRUE`, `GL_FALSE` or `GL_STATE_UNKNOWN`
+	GLuint	blend_func[2];	//!< The source and destination factors
+	GLint	viewport[4];
+	GLint	scissor[4];
+	int		viewport_known;
+	int		scissor_known;
+	long	calls;		//!< The amount of state changes which were asked for
+	long	filtered;	//!< The amount of state changes which were dropped, as they changed nothing
+}	s_gl_state;
+
+//! The shadow state of the current context
+extern s_gl_state	gl_state;
+
+//! Forgets all of the tracked state, and resets the call counters (call it when a context is made current)
+void	gl_state_init(void);
+//! Forgets all of the tracked state, which was changed without going through this layer
+void	gl_state_invalidate(void);
+
+void	gl_state_use_program(GLuint program);
+//! Binds a vertex array object (which also forgets the element array buffer binding, as it is part of the VAO)
+void	gl_state_bind_vertex_array(GLuint vertex_array);
+//! Binds a framebuffer to `GL_FRAMEBUFFER`, `GL_DRAW_FRAMEBUFFER` or `GL_READ_FRAMEBUFFER`
+void	gl_state_bind_framebuffer(GLenum target, GLuint framebuffer);
+//! Binds a buffer to one of the tracked targets (others are passed through)
+void	gl_state_bind_buffer(GLenum target, GLuint buffer);
+//! Binds a range of a buffer to an indexed binding point (only those of `GL_UNIFORM_BUFFER` are tracked)
+void	gl_state_bind_buffer_range(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+//! Binds a texture to the given unit (the active texture unit is switched only if a bind is needed)
+void	gl_state_bind_texture(GLuint unit, GLenum target, GLuint texture);
+
+//! Enables (if `enable` is nonzero) or disables one of the tracked capabilities (others are passed through)
+void	gl_state_enable(GLenum capability, int enable);
+void	gl_state_blend_func(GLenum source, GLenum destination);
+void	gl_state_viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+void	gl_state_scissor(GLint x, GLint y, GLsizei width, GLsizei height);
+
+//! Deletes buffers, forgetting the bindings of any of them which are bound
+void	gl_state_delete_buffers(GLsizei count, GLuint const* buffers);
+//! Deletes textures, forgetting the bindings of any of them which are bound
+void	gl_state_delete_textures(GLsizei count, GLuint const* textures);
+//! Deletes vertex arrays, forgetting the binding if one of them is bound
+void	gl_state_delete_vertex_arrays(GLsizei count, GLuint const* vertex_arrays);
+//! Deletes framebuffers, forgetting the bindings of any of them which are bound
+void	gl_state_delete_framebuffers(GLsizei count, GLuint const* framebuffers);
+
+#endif
@@ -0,0 +1,164 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "gl_util.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+
+void	gl_print_log(GLuint object, int is_program)
+{
+	GLint length = 0;
+	char* log;
+
+	if (is_program)
+		glGetProgramiv(object, GL_INFO_LOG_LENGTH, &length);
+	else
+		glGetShaderiv(object, GL_INFO_LOG_LENGTH, &length);
+	if (length <= 1 || !(log = (char*)malloc((size_t)length)))
+		return;
+	if (is_program)
+		glGetProgramInfoLog(object, length, NULL, log);
+	else
+		glGetShaderInfoLog(object, length, NULL, log);
+	fprintf(stderr, "%s\n", log);
+	free(log);
+}
+
+GLuint	gl_compile_shader(GLenum type, char const* source)
+{
+	GLuint shader = glCreateShader(type);
+	GLint status = GL_FALSE;
+
+	glShaderSource(shader, 1, &source, NULL);
+	glCompileShader(shader);
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+	if (status != GL_TRUE)
+	{
+		fprintf(stderr, "error: could not compile the %s shader:\n",
+			(type == GL_VERTEX_SHADER ? "vertex" : type == GL_FRAGMENT_SHADER ? "fragment" : "other"));
+		gl_print_log(shader, 0);
+		glDeleteShader(shader);
+		return 0;
+	}
+	return shader;
+}
+
+int		gl_link_program(GLuint program, char const* vertex_source, char const* fragment_source)
+{
+	GLuint vertex = gl_compile_shader(GL_VERTEX_SHADER, vertex_source);
+	GLuint fragment = gl_compile_shader(GL_FRAGMENT_SHADER, fragment_source);
+	GLint status = GL_FALSE;
+
+	if (vertex && fragment)
+	{
+		glAttachShader(program, vertex);
+		glAttachShader(program, fragment);
+		glLinkProgram(program);
+		glGetProgramiv(program, GL_LINK_STATUS, &status);
+		if (status != GL_TRUE)
+		{
+			fprintf(stderr, "error: could not link the program:\n");
+			gl_print_log(program, 1);
+		}
+		glDetachShader(program, vertex);
+		glDetachShader(program, fragment);
+	}
+	/* the program keeps what it needs: the shader objects can go */
+	if (vertex)
+		glDeleteShader(vertex);
+	if (fragment)
+		glDeleteShader(fragment);
+	return (status == GL_TRUE ? 0 : -1);
+}
+
+GLuint	gl_create_program(char const* vertex_source, char const* fragment_source)
+{
+	GLuint program = glCreateProgram();
+
+	if (gl_link_program(program, vertex_source, fragment_source))
+	{
+		glDeleteProgram(program);
+		return 0;
+	}
+	return program;
+}
+
+GLuint	gl_create_texture_rgba8(int width, int height, void const* pixels)
+{
+	GLuint texture;
+
+	glGenTextures(1, &texture);
+	gl_state_bind_texture(0, GL_TEXTURE_2D, texture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+	return texture;
+}
+
+//! Returns nonzero if the driver can sample textures of the given format
+static int	texture_format_supported(e_texture_format format)
+{
+	switch (format)
+	{
+		case TEXTURE_FORMAT_BC1:
+		case TEXTURE_FORMAT_BC3:
+			return gl_caps.texture_compression_s3tc;
+		case TEXTURE_FORMAT_BC7:
+			return gl_caps.texture_compression_bptc;
+		case TEXTURE_FORMAT_ETC2:
+			return gl_caps.texture_compression_etc2;
+		default:
+			return 1;
+	}
+}
+
+GLuint	gl_create_texture_file(s_texture_file const* file)
+{
+	s_texture_file_header const* header = file->header;
+	e_texture_format format = (e_texture_format)header->format;
+	GLenum internal_format = texture_format_info(format)->internal_format;
+	GLsizei levels = (GLsizei)header->level_count;
+	GLsizei width, height;
+	GLuint texture;
+	GLsizei i;
+
+	if (!texture_format_supported(format))
+	{
+		fprintf(stderr, "error: the driver does not support %s textures\n", texture_format_info(format)->name);
+		return 0;
+	}
+	glGenTextures(1, &texture);
+	gl_state_bind_texture(0, GL_TEXTURE_2D, texture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR));
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	/* the texels come from the mapping, not from a pixel buffer */
+	gl_state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	if (gl_caps.texture_storage)
+		glTexStorage2D(GL_TEXTURE_2D, levels, internal_format, (GLsizei)header->width, (GLsizei)header->height);
+	for (i = 0; i < levels; ++i)
+	{
+		width = ((GLsizei)header->width >> i ? (GLsizei)header->width >> i : 1);
+		height = ((GLsizei)header->height >> i ? (GLsizei)header->height >> i : 1);
+		if (format == TEXTURE_FORMAT_RGBA8 && gl_caps.texture_storage)
+			glTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, texture_file_level(file, i));
+		else if (format == TEXTURE_FORMAT_RGBA8)
+			glTexImage2D(GL_TEXTURE_2D, i, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+				texture_file_level(file, i));
+		else if (gl_caps.texture_storage)
+			glCompressedTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, width, height, internal_format,
+				(GLsizei)header->levels[i].size, texture_file_level(file, i));
+		else
+			glCompressedTexImage2D(GL_TEXTURE_2D, i, internal_format, width, height, 0,
+				(GLsizei)header->levels[i].size, texture_file_level(file, i));
+	}
+	return texture;
+}
@@ -0,0 +1,51 @@
+#ifndef GL_UTIL_H
+#define GL_UTIL_H
+
+#include <glad/glad.h>
+
+#include "texture_file.h"
+
+//! Prints the info log of a shader or program object, which failed to compile or link, to `stderr`
+void	gl_print_log(GLuint object, int is_program);
+
+//! Compiles a shader from its GLSL source
+/*!
+**	@param type		The shader stage, like `GL_VERTEX_SHADER`
+**	@param source	The GLSL source code, as a NUL-terminated string
+**	@returns
+**	The new shader object, or `0` if it failed to compile (the info log is printed to `stderr`)
+*/
+GLuint	gl_compile_shader(GLenum type, char const* source);
+
+//! Compiles a vertex shader and a fragment shader, and links them into an existing program object
+/*!
+**	This lets the caller set program parameters first (like `GL_PROGRAM_BINARY_RETRIEVABLE_HINT`).
+**	@returns
+**	`0` on success, `-1` if the shaders failed to compile or link (the info log is printed to `stderr`)
+*/
+int		gl_link_program(GLuint program, char const* vertex_source, char const* fragment_source);
+
+//! Compiles and links a program made of a vertex shader and a fragment shader
+/*!
+**	@returns
+**	The new program object, or `0` if it failed to compile or link (the info log is printed to `stderr`)
+*/
+GLuint	gl_create_program(char const* vertex_source, char const* fragment_source);
+
+//! Creates a 2D RGBA8 texture with linear filtering and no mipmaps
+/*!
+**	@param pixels	The texel data, as tightly packed RGBA bytes (or `NULL` to leave it undefined)
+**	@returns
+**	The new texture object (it is left bound to `GL_TEXTURE_2D`, on texture unit 0)
+*/
+GLuint	gl_create_texture_rgba8(int width, int height, void const* pixels);
+
+//! Creates a 2D texture, with its whole mip chain, straight from a mapped texture file (there is no copy but the driver's)
+/*!
+**	@returns
+**	The new texture object (it is left bound to `GL_TEXTURE_2D`, on texture unit 0),
+**	or `0` if the driver does not support its format (a message is printed to `stderr`)
+*/
+GLuint	gl_create_texture_file(s_texture_file const* file);
+
+#endif
@@ -0,0 +1,184 @@
+
+#include <stdio.h>
+#include <string.h>
+
+#include "gpu_ring.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "window.h"
+
+int		gpu_ring_init(s_gpu_ring* ring, size_t capacity)
+{
+	GLbitfield const persistent = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	memset(ring, 0, sizeof(s_gpu_ring));
+	ring->capacity = capacity;
+	glGenBuffers(1, &ring->buffer);
+	/* the copy target is used, so as not to disturb any vertex/index/uniform bindings */
+	gl_state_bind_buffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+	if (gl_caps.buffer_storage)
+	{
+		glBufferStorage(GL_COPY_WRITE_BUFFER, (GLsizeiptr)capacity, NULL, persistent);
+		ring->mapped = (uint8_t*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, (GLsizeiptr)capacity, persistent);
+	}
+	else
+		glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)capacity, NULL, GL_STREAM_DRAW);
+	if (gl_caps.buffer_storage && !ring->mapped)
+	{
+		fprintf(stderr, "error: could not map the %zu-byte ring buffer\n", capacity);
+		gl_state_delete_buffers(1, &ring->buffer);
+		ring->buffer = 0;
+		return -1;
+	}
+	return 0;
+}
+
+//! Waits for the oldest region in flight, and frees up its memory
+static void	retire(s_gpu_ring* ring, int wait)
+{
+	s_gpu_ring_region* region = &ring->regions[ring->oldest];
+	GLenum status;
+	uint64_t start;
+
+	status = glClientWaitSync(region->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+	if (status == GL_TIMEOUT_EXPIRED)
+	{
+		if (!wait)
+			return;
+		++ring->waits;
+		start = window_timer_value();
+		do
+			status = glClientWaitSync(region->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000u);
+		while (status == GL_TIMEOUT_EXPIRED);
+		ring->wait_ms += (double)(window_timer_value() - start) * 1000. / (double)window_timer_frequency();
+	}
+	glDeleteSync(region->fence);
+	ring->used -= region->size;
+	ring->oldest = (ring->oldest + 1) % GPU_RING_FENCES;
+	--ring->in_flight;
+}
+
+void	gpu_ring_free(s_gpu_ring* ring)
+{
+	if (!ring->buffer)
+		return;
+	gpu_ring_flush(ring);
+	while (ring->in_flight > 0)
+		retire(ring, 1);
+	if (ring->mapped)
+	{
+		gl_state_bind_buffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+		glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+	}
+	gl_state_delete_buffers(1, &ring->buffer);
+	ring->buffer = 0;
+	ring->mapped = NULL;
+}
+
+void*	gpu_ring_alloc(s_gpu_ring* ring, size_t size, size_t alignment, size_t* offset)
+{
+	size_t start;
+	size_t consumed;
+	void* result;
+
+	if (size > ring->capacity)
+		return NULL;
+	for (;;)
+	{
+		/* a drained ring starts over from the beginning, rather than wrapping around its free space */
+		if (ring->used == 0)
+			ring->head = 0;
+		start = (ring->head + alignment - 1) / alignment * alignment;
+		/* past the end: skip the rest of the buffer, and start over from the beginning */
+		if (start + size > ring->capacity)
+			start = 0;
+		consumed = (start >= ring->head ? start + size - ring->head : ring->capacity - ring->head + size);
+		if (ring->used + consumed <= ring->capacity)
+			break;
+		if (ring->in_flight == 0)
+		{
+			/* the memory in the way was allocated since the last fence: it has to be fenced first */
+			if (ring->pending == 0)
+				return NULL;
+			/* which may retire the new fence already, if the GPU is done with it: the space is checked again */
+			gpu_ring_fence(ring);
+			continue;
+		}
+		retire(ring, 1);
+	}
+	ring->head = start + size;
+	ring->used += consumed;
+	ring->pending += consumed;
+	*offset = start;
+	if (ring->mapped)
+		return ring->mapped + start;
+	/* no persistent mapping: the fences keep track of what the GPU uses, so the driver needn't */
+	gpu_ring_flush(ring);
+	gl_state_bind_buffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+	result = glMapBufferRange(GL_COPY_WRITE_BUFFER, (GLintptr)start, (GLsizeiptr)size,
+		GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+	ring->unmapped = (result != NULL);
+	return result;
+}
+
+int		gpu_ring_write_sorted(s_gpu_ring* ring, void const* elements, uint8_t const* keys, size_t count,
+	size_t size, int key_count, size_t* first)
+{
+	size_t next[GPU_RING_MAX_KEYS];
+	uint8_t* mapped;
+	size_t offset;
+	size_t i;
+	int key;
+
+	if (!(mapped = (uint8_t*)gpu_ring_alloc(ring, count * size, size, &offset)))
+		return -1;
+	/* counting sort: the size of each group gives where it starts */
+	memset(first, 0, ((size_t)key_count + 1) * sizeof(size_t));
+	first[0] = offset / size;
+	for (i = 0; i < count; ++i)
+		++first[keys[i] + 1];
+	for (key = 0; key < key_count; ++key)
+	{
+		first[key + 1] += first[key];
+		next[key] = first[key] - first[0];
+	}
+	if (key_count == 1)
+		memcpy(mapped, elements, count * size);
+	else
+	{
+		for (i = 0; i < count; ++i)
+			memcpy(mapped + next[keys[i]]++ * size, (uint8_t const*)elements + i * size, size);
+	}
+	gpu_ring_flush(ring);
+	return 0;
+}
+
+void	gpu_ring_flush(s_gpu_ring* ring)
+{
+	/* a coherent persistent mapping needs nothing: writes are visible to the commands issued after them */
+	if (!ring->unmapped)
+		return;
+	gl_state_bind_buffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+	glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+	ring->unmapped = 0;
+}
+
+void	gpu_ring_fence(s_gpu_ring* ring)
+{
+	s_gpu_ring_region* region;
+
+	if (ring->pending == 0)
+		return;
+	gpu_ring_flush(ring);
+	if (ring->in_flight == GPU_RING_FENCES)
+		retire(ring, 1);
+	region = &ring->regions[(ring->oldest + ring->in_flight) % GPU_RING_FENCES];
+	region->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	region->size = ring->pending;
+	ring->pending = 0;
+	++ring->in_flight;
+	++ring->fences;
+	/* free up whatever the GPU is already done with, without waiting */
+	while (ring->in_flight > 0 && glClientWaitSync(ring->regions[ring->oldest].fence, 0, 0) != GL_TIMEOUT_EXPIRED)
+		retire(ring, 0);
+}
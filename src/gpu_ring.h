@@ -0,0 +1,108 @@
+#ifndef GPU_RING_H
+#define GPU_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <glad/glad.h>
+
+/*
+**	A ring buffer allocator for data which the CPU writes each frame and the
+**	GPU reads once (vertices, uniforms, indirect commands): one GL buffer,
+**	written in place without `glBufferData()`/`glBufferSubData()` copies.
+**	With `GL_ARB_buffer_storage` (4.4), the buffer stays mapped for its whole
+**	life (persistent and coherent); on older drivers each allocation is mapped
+**	with `GL_MAP_UNSYNCHRONIZED_BIT` instead. Either way, the driver does not
+**	track what the GPU still reads: the ring puts a fence after each frame,
+**	and only reuses memory once the fence of the frame which used it is signaled.
+*/
+
+//! The most fenced regions (frames, usually) which can be in flight at once
+#define GPU_RING_FENCES	8
+
+//! The amount of frames which a ring is usually sized for: the CPU writes one while the GPU reads the 2 before
+#define GPU_RING_FRAMES	3
+
+//! The most groups which `gpu_ring_write_sorted()` sorts elements into (as many as there are key values)
+#define GPU_RING_MAX_KEYS	256
+
+//! A range of the ring which the GPU may still be reading, up to a fence
+typedef struct gpu_ring_region
+{
+	GLsync	fence;
+	size_t	size;	//!< The amount of bytes in this region, including any padding
+}	s_gpu_ring_region;
+
+//! The ring buffer, and how it was used
+typedef struct gpu_ring
+{
+	GLuint				buffer;
+	size_t				capacity;	//!< The size of `buffer`, in bytes
+	uint8_t*			mapped;		//!< The persistent mapping of the whole buffer (`NULL` if unsupported)
+	int					unmapped;	//!< Nonzero if an allocation is mapped and must be unmapped before drawing (without a persistent mapping)
+	size_t				head;		//!< The offset at which the next allocation starts
+	size_t				used;		//!< The amount of bytes from the oldest region in flight to `head`
+	size_t				pending;	//!< The amount of bytes allocated since the last fence
+	s_gpu_ring_region	regions[GPU_RING_FENCES];	//!< The regions in flight, oldest first (circular)
+	int					oldest;		//!< The index in `regions` of the oldest region in flight
+	int					in_flight;	//!< The amount of regions in flight
+	long				fences;		//!< The amount of fences placed so far
+	long				waits;		//!< The amount of times the CPU had to wait for the GPU to free up space
+	double				wait_ms;	//!< The total time spent waiting for the GPU, in milliseconds
+}	s_gpu_ring;
+
+//! Creates the ring buffer, returns `0` on success
+/*!
+**	@param ring		The ring to set up
+**	@param capacity	The size of the buffer, in bytes: enough for `GPU_RING_FRAMES` frames of data
+*/
+int		gpu_ring_init(s_gpu_ring* ring, size_t capacity);
+//! Waits for the GPU to be done with the ring, then deletes the buffer
+void	gpu_ring_free(s_gpu_ring* ring);
+
+//! Allocates memory from the ring, waiting for the GPU if it is full
+/*!
+**	@param ring			The ring to allocate from
+**	@param size			The amount of bytes to allocate
+**	@param alignment	The alignment of the allocation in the buffer (not necessarily a power of 2)
+**	@param offset		Set to the offset of the allocation in the ring's buffer, for binding it
+**	@returns
+**	The CPU address to write the data to, or `NULL` if `size` is more than the ring can hold.
+**	Without a persistent mapping, it is only valid until the next allocation, and
+**	`gpu_ring_flush()` must be called before the GPU reads it.
+**	If the ring is full of memory which was allocated since the last fence, that
+**	memory gets fenced and waited for: it must have been drawn with already.
+*/
+void*	gpu_ring_alloc(s_gpu_ring* ring, size_t size, size_t alignment, size_t* offset);
+
+//! Writes elements into the ring grouped by key (with a counting sort), and makes them visible to the GPU
+/*!
+**	This is how the batch renderers draw each group of their queue with one
+**	instanced call: the elements are aligned to their size in the ring, so
+**	that where each group starts is a whole instance index.
+**	@param ring			The ring to write to
+**	@param elements		The elements to write, in submission order
+**	@param keys			The group of each element, from `0` to `key_count - 1`
+**	@param count		The amount of elements
+**	@param size			The size of an element, in bytes
+**	@param key_count	The amount of groups (up to `GPU_RING_MAX_KEYS`)
+**	@param first		Receives where each group starts, in elements from the start of the buffer,
+**						and where the last one ends (`key_count + 1` of them)
+**	@returns
+**	`0` on success, or `-1` if the ring could not be mapped
+*/
+int		gpu_ring_write_sorted(s_gpu_ring* ring, void const* elements, uint8_t const* keys, size_t count,
+			size_t size, int key_count, size_t* first);
+
+//! Makes the memory which was allocated visible to the GPU: call this before drawing with it
+void	gpu_ring_flush(s_gpu_ring* ring);
+
+//! Places a fence after the commands which read the memory allocated since the last fence
+/*!
+**	Call this once per frame, after the frame's draw calls. Producers which
+**	allocate more than a frame's share of the ring at once may also call it
+**	after each batch which they drew, so that the ring can be reused sooner.
+*/
+void	gpu_ring_fence(s_gpu_ring* ring);
+
+#endif
@@ -0,0 +1,54 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <png.h>
+
+#include "image_png.h"
+
+uint8_t*	image_png_load(char const* path, int* width, int* height)
+{
+	png_image image;
+	uint8_t* pixels = NULL;
+
+	memset(&image, 0, sizeof(image));
+	image.version = PNG_IMAGE_VERSION;
+	if (png_image_begin_read_from_file(&image, path))
+	{
+		/* whatever the file holds (gray, palette, 16 bits), it is converted to 8-bit RGBA */
+		image.format = PNG_FORMAT_RGBA;
+		if ((pixels = (uint8_t*)malloc(PNG_IMAGE_SIZE(image))) &&
+			!png_image_finish_read(&image, NULL, pixels, 0, NULL))
+		{
+			free(pixels);
+			pixels = NULL;
+		}
+	}
+	if (!pixels)
+	{
+		fprintf(stderr, "error: could not read '%s': %s\n", path, image.message);
+		png_image_free(&image);
+		return NULL;
+	}
+	*width = (int)image.width;
+	*height = (int)image.height;
+	return pixels;
+}
+
+int		image_png_save(char const* path, uint8_t const* pixels, int width, int height)
+{
+	png_image image;
+
+	memset(&image, 0, sizeof(image));
+	image.version = PNG_IMAGE_VERSION;
+	image.width = (png_uint_32)width;
+	image.height = (png_uint_32)height;
+	image.format = PNG_FORMAT_RGBA;
+	if (!png_image_write_to_file(&image, path, 0, pixels, 0, NULL))
+	{
+		fprintf(stderr, "error: could not write '%s': %s\n", path, image.message);
+		return -1;
+	}
+	return 0;
+}
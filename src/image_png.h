@@ -0,0 +1,25 @@
+#ifndef IMAGE_PNG_H
+#define IMAGE_PNG_H
+
+#include <stdint.h>
+
+/*
+**	PNG files, through libpng: the source images of textures, which the
+**	`texconv` tool converts to texture files (see `texture_file.h`).
+*/
+
+//! Decodes a PNG file into RGBA bytes
+/*!
+**	@param path		The file to read
+**	@param width	Set to the width of the image, in pixels
+**	@param height	Set to the height of the image, in pixels
+**	@returns
+**	The pixels, tightly packed, first row at the top of the image (to `free()`),
+**	or `NULL` on failure (a message is printed to `stderr`)
+*/
+uint8_t*	image_png_load(char const* path, int* width, int* height);
+
+//! Encodes RGBA bytes as a PNG file, returns `0` on success
+int		image_png_save(char const* path, uint8_t const* pixels, int width, int height);
+
+#endif
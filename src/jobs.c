@@ -0,0 +1,274 @@
+
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "jobs.h"
+
+//! The job system which the calling thread belongs to (`NULL` if none)
+static _Thread_local s_jobs*	current_jobs = NULL;
+//! The index of the calling thread in `current_jobs`
+static _Thread_local int		current_thread = 0;
+
+int		jobs_cpu_count(void)
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
+#else
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (count > 0 ? (int)count : 1);
+#endif
+}
+
+//! Pushes a job at the bottom of a deque (only by its owner), returns `0` on success or `-1` if it is full
+static int	deque_push(s_job_deque* deque, s_job const* job)
+{
+	long long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+	long long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+
+	if (bottom - top >= JOBS_DEQUE)
+		return -1;
+	deque->items[bottom & (JOBS_DEQUE - 1)] = *job;
+	atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release);
+	return 0;
+}
+
+//! Pops the job at the bottom of a deque (only by its owner), returns `0` on success or `-1` if it is empty
+static int	deque_pop(s_job_deque* deque, s_job* job)
+{
+	long long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+	long long top;
+	int status = 0;
+
+	atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+	top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+	if (top > bottom)
+	{
+		atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+		return -1;
+	}
+	*job = deque->items[bottom & (JOBS_DEQUE - 1)];
+	/* the last job may be stolen at the same time: whoever moves `top` on first has it */
+	if (top == bottom)
+	{
+		if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+			memory_order_seq_cst, memory_order_relaxed))
+			status = -1;
+		atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+	}
+	return status;
+}
+
+//! Steals the job at the top of a deque (by any thread), returns `0` on success or `-1` if it is empty or contended
+static int	deque_steal(s_job_deque* deque, s_job* job)
+{
+	long long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+	long long bottom;
+
+	atomic_thread_fence(memory_order_seq_cst);
+	bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+	if (top >= bottom)
+		return -1;
+	/* if the owner took this job meanwhile, and reused its slot, `top` moved on: the copy is dropped */
+	*job = deque->items[top & (JOBS_DEQUE - 1)];
+	return (atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+		memory_order_seq_cst, memory_order_relaxed) ? 0 : -1);
+}
+
+//! Takes a job from the deque of `thread`, or steals one from another thread, returns `0` on success
+static int	take(s_jobs* jobs, int thread, s_job* job)
+{
+	int victim;
+	int i;
+
+	if (deque_pop(&jobs->deques[thread], job) == 0)
+	{
+		atomic_fetch_sub(&jobs->queued, 1);
+		return 0;
+	}
+	/* the victims are tried in turn, from the next thread on, so that thieves spread out */
+	for (i = 1; i < jobs->thread_count; ++i)
+	{
+		victim = (thread + i) % jobs->thread_count;
+		if (deque_steal(&jobs->deques[victim], job) == 0)
+		{
+			atomic_fetch_sub(&jobs->queued, 1);
+			atomic_fetch_add_explicit(&jobs->stolen, 1, memory_order_relaxed);
+			return 0;
+		}
+	}
+	return -1;
+}
+
+static void	execute(s_jobs* jobs, s_job const* job)
+{
+	job->run(job->data, job->begin, job->end);
+	atomic_fetch_add_explicit(&jobs->executed, 1, memory_order_relaxed);
+	atomic_fetch_sub_explicit(&job->counter->pending, 1, memory_order_release);
+}
+
+//! Runs jobs, and sleeps while there are none, until the job system is freed
+static void*	worker_run(void* data)
+{
+	s_job_worker* worker = (s_job_worker*)data;
+	s_jobs* jobs = worker->jobs;
+	s_job job;
+
+	current_jobs = jobs;
+	current_thread = worker->index;
+	while (!atomic_load(&jobs->quit))
+	{
+		if (take(jobs, worker->index, &job) == 0)
+		{
+			execute(jobs, &job);
+			continue;
+		}
+		/* the sleepers are counted before `queued` is checked: a submitter sees one or the other */
+		pthread_mutex_lock(&jobs->lock);
+		atomic_fetch_add(&jobs->sleepers, 1);
+		while (atomic_load(&jobs->queued) <= 0 && !atomic_load(&jobs->quit))
+			pthread_cond_wait(&jobs->wake, &jobs->lock);
+		atomic_fetch_sub(&jobs->sleepers, 1);
+		pthread_mutex_unlock(&jobs->lock);
+	}
+	return NULL;
+}
+
+int		jobs_init(s_jobs* jobs, int threads)
+{
+	int i;
+
+	memset(jobs, 0, sizeof(s_jobs));
+	if (threads < 1 || threads > JOBS_MAX_THREADS)
+	{
+		fprintf(stderr, "error: the job system needs 1 to %d threads\n", JOBS_MAX_THREADS);
+		return -1;
+	}
+	if (!(jobs->deques = (s_job_deque*)calloc((size_t)threads, sizeof(s_job_deque))))
+	{
+		fprintf(stderr, "error: could not allocate the job deques\n");
+		return -1;
+	}
+	jobs->thread_count = threads;
+	current_jobs = jobs;
+	current_thread = 0;
+	pthread_mutex_init(&jobs->lock, NULL);
+	pthread_cond_init(&jobs->wake, NULL);
+	for (i = 1; i < threads; ++i)
+	{
+		jobs->workers[i].jobs = jobs;
+		jobs->workers[i].index = i;
+		if (pthread_create(&jobs->workers[i].thread, NULL, worker_run, &jobs->workers[i]))
+		{
+			fprintf(stderr, "error: could not start the job threads\n");
+			jobs->thread_count = i;
+			jobs_free(jobs);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+void	jobs_free(s_jobs* jobs)
+{
+	int i;
+
+	pthread_mutex_lock(&jobs->lock);
+	atomic_store(&jobs->quit, 1);
+	pthread_cond_broadcast(&jobs->wake);
+	pthread_mutex_unlock(&jobs->lock);
+	for (i = 1; i < jobs->thread_count; ++i)
+		pthread_join(jobs->workers[i].thread, NULL);
+	pthread_mutex_destroy(&jobs->lock);
+	pthread_cond_destroy(&jobs->wake);
+	free(jobs->deques);
+	if (current_jobs == jobs)
+		current_jobs = NULL;
+	memset(jobs, 0, sizeof(s_jobs));
+}
+
+void	jobs_attach(s_jobs* jobs)
+{
+	current_jobs = jobs;
+	current_thread = 0;
+}
+
+void	jobs_run(s_jobs* jobs, s_job const* list, size_t count, s_job_counter* counter)
+{
+	s_job job;
+	int pushed = 0;
+	size_t i;
+
+	atomic_fetch_add(&counter->pending, (int)count);
+	for (i = 0; i < count; ++i)
+	{
+		job = list[i];
+		job.counter = counter;
+		/* a thread outside of the job system, or a full deque, runs the job right away */
+		if (current_jobs != jobs || deque_push(&jobs->deques[current_thread], &job))
+			execute(jobs, &job);
+		else
+			++pushed;
+	}
+	if (pushed == 0)
+		return;
+	atomic_fetch_add(&jobs->queued, pushed);
+	if (atomic_load(&jobs->sleepers) > 0)
+	{
+		pthread_mutex_lock(&jobs->lock);
+		pthread_cond_broadcast(&jobs->wake);
+		pthread_mutex_unlock(&jobs->lock);
+	}
+}
+
+void	jobs_wait(s_jobs* jobs, s_job_counter* counter)
+{
+	s_job job;
+
+	/* rather than sleeping, the waiting thread helps: with its own jobs first, then other threads' */
+	while (atomic_load_explicit(&counter->pending, memory_order_acquire) > 0)
+	{
+		if (current_jobs == jobs && take(jobs, current_thread, &job) == 0)
+			execute(jobs, &job);
+		else
+			sched_yield();
+	}
+}
+
+void	jobs_parallel_for(s_jobs* jobs, size_t count, size_t grain,
+	void (*run)(void* data, size_t begin, size_t end), void* data)
+{
+	s_job list[JOBS_MAX_CHUNKS];
+	s_job_counter counter;
+	size_t chunk, chunks;
+	size_t i;
+
+	if (count == 0)
+		return;
+	chunk = (grain > 0 ? grain : 1);
+	if ((count + chunk - 1) / chunk > JOBS_MAX_CHUNKS)
+		chunk = (count + JOBS_MAX_CHUNKS - 1) / JOBS_MAX_CHUNKS;
+	chunks = (count + chunk - 1) / chunk;
+	for (i = 0; i < chunks; ++i)
+	{
+		list[i].run = run;
+		list[i].data = data;
+		list[i].begin = i * chunk;
+		list[i].end = (i + 1 == chunks ? count : (i + 1) * chunk);
+	}
+	atomic_init(&counter.pending, 0);
+	jobs_run(jobs, list, chunks, &counter);
+	jobs_wait(jobs, &counter);
+}
@@ -0,0 +1,109 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+#include <pthread.h>
+
+/*
+**	A job system for the CPU work of each frame (culling, animation, sorting,
+**	filling buffers), on a thread per core. Each thread, the main one
+**	included, has its own deque of jobs: it pushes and pops jobs at the
+**	bottom, without a lock, while the other threads steal from the top when
+**	they run out of work (a Chase-Lev deque). Jobs count down a counter when
+**	they are done: the thread which waits for a counter runs jobs meanwhile,
+**	rather than sleeping, so that a job may wait for the jobs it spawned.
+**	Only the main thread (the one which set up the job system, or which was
+**	attached to it since) and jobs themselves may submit jobs. GL calls must
+**	stay on the main thread: fan the work out, wait for it, then submit the
+**	results.
+*/
+
+//! The most threads, the main one included
+#define JOBS_MAX_THREADS	64
+//! The most jobs in the deque of a thread (a power of 2): past this, jobs are run as they are submitted
+#define JOBS_DEQUE			4096
+//! The most jobs which `jobs_parallel_for()` splits its range into
+#define JOBS_MAX_CHUNKS		256
+
+//! Counts the jobs which are not done yet, so that they can be waited for
+typedef struct job_counter
+{
+	atomic_int	pending;
+}	s_job_counter;
+
+//! A job: a function, called for a range of items
+typedef struct job
+{
+	void			(*run)(void* data, size_t begin, size_t end);	//!< Does the work, for the items from `begin` to `end` (excluded)
+	void*			data;
+	size_t			begin;
+	size_t			end;
+	s_job_counter*	counter;	//!< Counted down once the job is done (set by `jobs_run()`)
+}	s_job;
+
+//! The deque of jobs of a thread
+typedef struct job_deque
+{
+	s_job		items[JOBS_DEQUE];
+	atomic_llong	top;		//!< The next job to steal (moved on by the thieves)
+	char		padding[64];	//!< Keeps `top` and `bottom` on distinct cache lines
+	atomic_llong	bottom;		//!< The next free slot (only written by the owner)
+}	s_job_deque;
+
+struct jobs;
+
+//! A thread besides the main one, and what it is started with
+typedef struct job_worker
+{
+	pthread_t		thread;
+	struct jobs*	jobs;
+	int				index;		//!< Its deque, in `jobs`
+}	s_job_worker;
+
+//! The threads, and their deques
+typedef struct jobs
+{
+	s_job_deque*	deques;		//!< One per thread: the main thread's is the first
+	int				thread_count;
+	s_job_worker	workers[JOBS_MAX_THREADS];	//!< The threads besides the main one (from index 1)
+	pthread_mutex_t	lock;		//!< Only protects the workers' sleep
+	pthread_cond_t	wake;		//!< Signaled when jobs are submitted while workers sleep, or when they must quit
+	atomic_int		sleepers;	//!< The amount of workers which sleep, or are about to
+	atomic_int		queued;		//!< The amount of jobs in the deques
+	atomic_int		quit;
+	atomic_long		executed;	//!< The amount of jobs which were run
+	atomic_long		stolen;		//!< The amount of jobs which were run by another thread than the one which submitted them
+}	s_jobs;
+
+//! Returns the amount of CPUs, which is the default amount of threads
+int		jobs_cpu_count(void);
+
+//! Starts the worker threads, returns `0` on success
+/*!
+**	@param jobs		The job system to set up: the calling thread becomes its main thread
+**	@param threads	The amount of threads which run jobs, the main one included (at most `JOBS_MAX_THREADS`):
+**					with 1, jobs run on the main thread, as it waits for them
+*/
+int		jobs_init(s_jobs* jobs, int threads);
+//! Stops the worker threads (every counter must have been waited for)
+void	jobs_free(s_jobs* jobs);
+//! Makes the calling thread the main thread of the job system, in place of the one which submitted jobs so far (which must stop)
+void	jobs_attach(s_jobs* jobs);
+
+//! Submits jobs, and counts them up on `counter`
+/*!
+**	@param jobs		The job system
+**	@param list		The jobs to run (they are copied)
+**	@param count	The amount of jobs
+**	@param counter	Counted down as each job is done: wait for it with `jobs_wait()`
+*/
+void	jobs_run(s_jobs* jobs, s_job const* list, size_t count, s_job_counter* counter);
+//! Runs jobs until every job counted on `counter` is done
+void	jobs_wait(s_jobs* jobs, s_job_counter* counter);
+//! Splits `count` items into jobs of at least `grain` items, runs them and waits for them
+void	jobs_parallel_for(s_jobs* jobs, size_t count, size_t grain,
+			void (*run)(void* data, size_t begin, size_t end), void* data);
+
+#endif
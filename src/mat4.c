@@ -0,0 +1,85 @@
+
+#include <math.h>
+#include <string.h>
+
+#include "mat4.h"
+
+void	mat4_identity(s_mat4* result)
+{
+	memset(result, 0, sizeof(s_mat4));
+	result->m[0] = 1.f;
+	result->m[5] = 1.f;
+	result->m[10] = 1.f;
+	result->m[15] = 1.f;
+}
+
+void	mat4_multiply(s_mat4* result, s_mat4 const* a, s_mat4 const* b)
+{
+	s_mat4 product;
+	int column, row, k;
+
+	for (column = 0; column < 4; ++column)
+	{
+		for (row = 0; row < 4; ++row)
+		{
+			product.m[column * 4 + row] = 0.f;
+			for (k = 0; k < 4; ++k)
+				product.m[column * 4 + row] += a->m[k * 4 + row] * b->m[column * 4 + k];
+		}
+	}
+	*result = product;
+}
+
+void	mat4_perspective(s_mat4* result, float fov_y, float aspect, float near, float far)
+{
+	float f = 1.f / tanf(fov_y / 2.f);
+
+	memset(result, 0, sizeof(s_mat4));
+	result->m[0] = f / aspect;
+	result->m[5] = f;
+	result->m[10] = (far + near) / (near - far);
+	result->m[11] = -1.f;
+	result->m[14] = 2.f * far * near / (near - far);
+}
+
+static void	normalize(float v[3])
+{
+	float length = sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+
+	if (length > 0.f)
+	{
+		v[0] /= length;
+		v[1] /= length;
+		v[2] /= length;
+	}
+}
+
+static void	cross(float result[3], float const a[3], float const b[3])
+{
+	result[0] = a[1] * b[2] - a[2] * b[1];
+	result[1] = a[2] * b[0] - a[0] * b[2];
+	result[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+void	mat4_look_at(s_mat4* result, float const eye[3], float const target[3], float const up[3])
+{
+	float forward[3] = { target[0] - eye[0], target[1] - eye[1], target[2] - eye[2] };
+	float side[3];
+	float top[3];
+	int i;
+
+	normalize(forward);
+	cross(side, forward, up);
+	normalize(side);
+	cross(top, side, forward);
+	mat4_identity(result);
+	for (i = 0; i < 3; ++i)
+	{
+		result->m[i * 4 + 0] = side[i];
+		result->m[i * 4 + 1] = top[i];
+		result->m[i * 4 + 2] = -forward[i];
+	}
+	result->m[12] = -(side[0] * eye[0] + side[1] * eye[1] + side[2] * eye[2]);
+	result->m[13] = -(top[0] * eye[0] + top[1] * eye[1] + top[2] * eye[2]);
+	result->m[14] = (forward[0] * eye[0] + forward[1] * eye[1] + forward[2] * eye[2]);
+}
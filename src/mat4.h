@@ -0,0 +1,19 @@
+#ifndef MAT4_H
+#define MAT4_H
+
+//! A 4x4 matrix of floats, in column-major order (as GL expects it)
+typedef struct mat4
+{
+	float	m[16];
+}	s_mat4;
+
+//! Sets `result` to the identity matrix
+void	mat4_identity(s_mat4* result);
+//! Sets `result` to `a * b` (`result` may be either of them)
+void	mat4_multiply(s_mat4* result, s_mat4 const* a, s_mat4 const* b);
+//! Sets `result` to a right-handed perspective projection, with a vertical field of view in radians
+void	mat4_perspective(s_mat4* result, float fov_y, float aspect, float near, float far);
+//! Sets `result` to a right-handed view matrix, from the eye position, a target point and the up direction
+void	mat4_look_at(s_mat4* result, float const eye[3], float const target[3], float const up[3]);
+
+#endif
@@ -0,0 +1,361 @@
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "meshes.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "gl_util.h"
+
+static char const* const	meshes_vertex_shader =
+	"#version 330 core\n"
+	"layout(location = 0) in vec3 a_position;\n"
+	"layout(location = 1) in vec3 a_normal;\n"
+	"layout(location = 2) in vec4 a_row0;\n"
+	"layout(location = 3) in vec4 a_row1;\n"
+	"layout(location = 4) in vec4 a_row2;\n"
+	"layout(location = 5) in vec4 a_color;\n"
+	"uniform mat4 u_view_projection;\n"
+	"out vec4 v_color;\n"
+	"void main()\n"
+	"{\n"
+	"	vec4 position = vec4(a_position, 1.);\n"
+	"	vec3 world = vec3(dot(a_row0, position), dot(a_row1, position), dot(a_row2, position));\n"
+	"	vec3 normal = normalize(vec3(dot(a_row0.xyz, a_normal), dot(a_row1.xyz, a_normal), dot(a_row2.xyz, a_normal)));\n"
+	"	float light = 0.3 + 0.7 * max(dot(normal, vec3(0.37, 0.74, 0.56)), 0.);\n"
+	"	v_color = vec4(a_color.rgb * light, a_color.a);\n"
+	"	gl_Position = u_view_projection * vec4(world, 1.);\n"
+	"}\n";
+
+static char const* const	meshes_fragment_shader =
+	"#version 330 core\n"
+	"in vec4 v_color;\n"
+	"out vec4 f_color;\n"
+	"void main()\n"
+	"{\n"
+	"	f_color = v_color;\n"
+	"}\n";
+
+int		mesh_create(s_mesh* mesh, s_mesh_vertex const* vertices, size_t vertex_count,
+	uint16_t const* indices, size_t index_count)
+{
+	memset(mesh, 0, sizeof(s_mesh));
+	glGenVertexArrays(1, &mesh->vertex_array);
+	glGenBuffers(2, mesh->buffers);
+	gl_state_bind_vertex_array(mesh->vertex_array);
+	gl_state_bind_buffer(GL_ARRAY_BUFFER, mesh->buffers[0]);
+	glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(vertex_count * sizeof(s_mesh_vertex)), vertices, GL_STATIC_DRAW);
+	gl_state_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, mesh->buffers[1]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(index_count * sizeof(uint16_t)), indices, GL_STATIC_DRAW);
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(s_mesh_vertex), (void const*)offsetof(s_mesh_vertex, position));
+	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(s_mesh_vertex), (void const*)offsetof(s_mesh_vertex, normal));
+	mesh->index_count = (GLsizei)index_count;
+	return 0;
+}
+
+//! Appends a flat-shaded polygon (a triangle or a quad, counter-clockwise) to a mesh being built
+static void	add_face(s_mesh_vertex* vertices, size_t* vertex_count, uint16_t* indices, size_t* index_count,
+	float const (*corners)[3], int corner_count)
+{
+	float const* a = corners[0];
+	float const* b = corners[1];
+	float const* c = corners[2];
+	float normal[3];
+	float length;
+	uint16_t first = (uint16_t)*vertex_count;
+	int i;
+
+	normal[0] = (b[1] - a[1]) * (c[2] - a[2]) - (b[2] - a[2]) * (c[1] - a[1]);
+	normal[1] = (b[2] - a[2]) * (c[0] - a[0]) - (b[0] - a[0]) * (c[2] - a[2]);
+	normal[2] = (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+	length = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+	for (i = 0; i < corner_count; ++i)
+	{
+		memcpy(vertices[*vertex_count].position, corners[i], sizeof(float[3]));
+		vertices[*vertex_count].normal[0] = normal[0] / length;
+		vertices[*vertex_count].normal[1] = normal[1] / length;
+		vertices[*vertex_count].normal[2] = normal[2] / length;
+		++*vertex_count;
+	}
+	for (i = 2; i < corner_count; ++i)
+	{
+		indices[(*index_count)++] = first;
+		indices[(*index_count)++] = (uint16_t)(first + i - 1);
+		indices[(*index_count)++] = (uint16_t)(first + i);
+	}
+}
+
+//! Builds the vertices and indices of a built-in mesh (24 vertices and 36 indices at most), returns `0` on success
+static int	build_shape(e_mesh_shape shape, s_mesh_vertex* vertices, size_t* vertex_count,
+	uint16_t* indices, size_t* index_count)
+{
+	/* the corners of each face of a cube, counter-clockwise seen from outside: -X, +X, -Y, +Y, -Z, +Z */
+	static float const	cube[6][4][3] =
+	{
+		{ { -.5f, -.5f, -.5f }, { -.5f, -.5f,  .5f }, { -.5f,  .5f,  .5f }, { -.5f,  .5f, -.5f } },
+		{ {  .5f, -.5f,  .5f }, {  .5f, -.5f, -.5f }, {  .5f,  .5f, -.5f }, {  .5f,  .5f,  .5f } },
+		{ { -.5f, -.5f, -.5f }, {  .5f, -.5f, -.5f }, {  .5f, -.5f,  .5f }, { -.5f, -.5f,  .5f } },
+		{ { -.5f,  .5f,  .5f }, {  .5f,  .5f,  .5f }, {  .5f,  .5f, -.5f }, { -.5f,  .5f, -.5f } },
+		{ {  .5f, -.5f, -.5f }, { -.5f, -.5f, -.5f }, { -.5f,  .5f, -.5f }, {  .5f,  .5f, -.5f } },
+		{ { -.5f, -.5f,  .5f }, {  .5f, -.5f,  .5f }, {  .5f,  .5f,  .5f }, { -.5f,  .5f,  .5f } },
+	};
+	static float const	quad[4][3] =
+	{
+		{ -.5f, -.5f, 0.f }, { .5f, -.5f, 0.f }, { .5f, .5f, 0.f }, { -.5f, .5f, 0.f }
+	};
+	float face[3][3];
+	int i;
+
+	*vertex_count = 0;
+	*index_count = 0;
+	switch (shape)
+	{
+		case MESH_SHAPE_CUBE:
+			for (i = 0; i < 6; ++i)
+				add_face(vertices, vertex_count, indices, index_count, cube[i], 4);
+			break;
+		case MESH_SHAPE_OCTAHEDRON:
+			/* one face per octant: the signs of i's bits give the direction of each axis */
+			for (i = 0; i < 8; ++i)
+			{
+				float x = (i & 1 ? -.5f : .5f);
+				float y = (i & 2 ? -.5f : .5f);
+				float z = (i & 4 ? -.5f : .5f);
+				memset(face, 0, sizeof(face));
+				face[0][0] = x;
+				/* keep the winding counter-clockwise, seen from outside */
+				face[(x * y * z > 0.f) ? 1 : 2][1] = y;
+				face[(x * y * z > 0.f) ? 2 : 1][2] = z;
+				add_face(vertices, vertex_count, indices, index_count, (float const (*)[3])face, 3);
+			}
+			break;
+		case MESH_SHAPE_QUAD:
+			add_face(vertices, vertex_count, indices, index_count, quad, 4);
+			break;
+		default:
+			return -1;
+	}
+	return 0;
+}
+
+int		mesh_create_shape(s_mesh* mesh, e_mesh_shape shape)
+{
+	s_mesh_vertex vertices[24];
+	uint16_t indices[36];
+	size_t vertex_count;
+	size_t index_count;
+
+	if (build_shape(shape, vertices, &vertex_count, indices, &index_count))
+		return -1;
+	return mesh_create(mesh, vertices, vertex_count, indices, index_count);
+}
+
+int		mesh_create_shapes(s_mesh* mesh, s_draw_range ranges[ENUMLENGTH_MESH_SHAPE])
+{
+	s_mesh_vertex vertices[ENUMLENGTH_MESH_SHAPE * 24];
+	uint16_t indices[ENUMLENGTH_MESH_SHAPE * 36];
+	size_t vertex_count = 0;
+	size_t index_count = 0;
+	size_t shape_vertices;
+	size_t shape_indices;
+	int shape;
+
+	/* each shape keeps its own indices, from 0: its range's base vertex is added to them */
+	for (shape = 0; shape < ENUMLENGTH_MESH_SHAPE; ++shape)
+	{
+		build_shape((e_mesh_shape)shape, &vertices[vertex_count], &shape_vertices, &indices[index_count], &shape_indices);
+		ranges[shape].first_index = (GLuint)index_count;
+		ranges[shape].index_count = (GLuint)shape_indices;
+		ranges[shape].base_vertex = (GLint)vertex_count;
+		vertex_count += shape_vertices;
+		index_count += shape_indices;
+	}
+	return mesh_create(mesh, vertices, vertex_count, indices, index_count);
+}
+
+void	mesh_free(s_mesh* mesh)
+{
+	if (mesh->vertex_array)
+		gl_state_delete_vertex_arrays(1, &mesh->vertex_array);
+	if (mesh->buffers[0])
+		gl_state_delete_buffers(2, mesh->buffers);
+	memset(mesh, 0, sizeof(s_mesh));
+}
+
+int		meshes_init(s_meshes* meshes, size_t batch)
+{
+	memset(meshes, 0, sizeof(s_meshes));
+	meshes->batch = (batch ? batch : MESHES_DEFAULT_BATCH);
+	meshes->queue = (s_mesh_instance*)malloc(meshes->batch * sizeof(s_mesh_instance));
+	meshes->keys = (uint8_t*)malloc(meshes->batch);
+	if (!meshes->queue || !meshes->keys ||
+		!(meshes->program = gl_create_program(meshes_vertex_shader, meshes_fragment_shader)) ||
+		gpu_ring_init(&meshes->ring, GPU_RING_FRAMES * meshes->batch * sizeof(s_mesh_instance)))
+	{
+		meshes_free(meshes);
+		return -1;
+	}
+	meshes->view_projection_location = glGetUniformLocation(meshes->program, "u_view_projection");
+	return 0;
+}
+
+void	meshes_free(s_meshes* meshes)
+{
+	if (meshes->program)
+		glDeleteProgram(meshes->program);
+	gpu_ring_free(&meshes->ring);
+	free(meshes->queue);
+	free(meshes->keys);
+	memset(meshes, 0, sizeof(s_meshes));
+}
+
+void	meshes_begin(s_meshes* meshes, s_mat4 const* view_projection)
+{
+	meshes->view_projection = *view_projection;
+	meshes->count = 0;
+	meshes->kind_count = 0;
+	meshes->last_kind = 0;
+	meshes->draw_calls = 0;
+	meshes->drawn = 0;
+}
+
+//! Returns the index of the given mesh among the queued ones, adding it if needed
+static int	find_kind(s_meshes* meshes, s_mesh* mesh)
+{
+	int i;
+
+	for (i = 0; i < meshes->kind_count; ++i)
+	{
+		if (meshes->kinds[i] == mesh)
+			return i;
+	}
+	if (meshes->kind_count == MESHES_MAX_KINDS)
+		meshes_flush(meshes);
+	meshes->kinds[meshes->kind_count] = mesh;
+	return meshes->kind_count++;
+}
+
+s_mesh_instance*	meshes_add(s_meshes* meshes, s_mesh* mesh)
+{
+	int key = meshes->last_kind;
+
+	if (key >= meshes->kind_count || meshes->kinds[key] != mesh)
+		key = find_kind(meshes, mesh);
+	if (meshes->count == meshes->batch)
+	{
+		meshes_flush(meshes);
+		key = find_kind(meshes, mesh);
+	}
+	meshes->last_kind = key;
+	meshes->keys[meshes->count] = (uint8_t)key;
+	return &meshes->queue[meshes->count++];
+}
+
+s_mesh_instance*	meshes_add_many(s_meshes* meshes, s_mesh* mesh, size_t count)
+{
+	s_mesh_instance* first;
+	int key;
+
+	if (count > meshes->batch)
+		return NULL;
+	if (meshes->count + count > meshes->batch)
+		meshes_flush(meshes);
+	key = find_kind(meshes, mesh);
+	meshes->last_kind = key;
+	memset(&meshes->keys[meshes->count], key, count);
+	first = &meshes->queue[meshes->count];
+	meshes->count += count;
+	return first;
+}
+
+//! Points the per-instance attributes of the current vertex array at the instances which start at `offset` bytes into the ring
+static void	set_instance_attributes(size_t offset)
+{
+	int row;
+
+	for (row = 0; row < 3; ++row)
+		glVertexAttribPointer((GLuint)(2 + row), 4, GL_FLOAT, GL_FALSE, sizeof(s_mesh_instance),
+			(void const*)(offset + offsetof(s_mesh_instance, transform) + (size_t)row * sizeof(float[4])));
+	glVertexAttribPointer(5, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(s_mesh_instance),
+		(void const*)(offset + offsetof(s_mesh_instance, color)));
+}
+
+void	mesh_bind_instances(s_mesh* mesh, GLuint buffer)
+{
+	GLuint i;
+
+	/* the attributes are pointed at `buffer` every time: a buffer's name may be reused once it is deleted */
+	gl_state_bind_vertex_array(mesh->vertex_array);
+	gl_state_bind_buffer(GL_ARRAY_BUFFER, buffer);
+	for (i = 2; i <= 5; ++i)
+	{
+		glEnableVertexAttribArray(i);
+		glVertexAttribDivisor(i, 1);
+	}
+	set_instance_attributes(0);
+}
+
+void	meshes_flush(s_meshes* meshes)
+{
+	size_t first[MESHES_MAX_KINDS + 1];
+	s_mesh* mesh;
+	int kind;
+
+	if (meshes->count == 0)
+		return;
+	if (gpu_ring_write_sorted(&meshes->ring, meshes->queue, meshes->keys, meshes->count, sizeof(s_mesh_instance),
+		meshes->kind_count, first))
+		fprintf(stderr, "error: could not map the instance buffer\n");
+	else
+	{
+		gl_state_use_program(meshes->program);
+		glUniformMatrix4fv(meshes->view_projection_location, 1, GL_FALSE, meshes->view_projection.m);
+		gl_state_enable(GL_DEPTH_TEST, 1);
+		gl_state_enable(GL_CULL_FACE, 1);
+		gl_state_enable(GL_BLEND, 0);
+		for (kind = 0; kind < meshes->kind_count; ++kind)
+		{
+			if (first[kind + 1] == first[kind])
+				continue;
+			mesh = meshes->kinds[kind];
+			mesh_bind_instances(mesh, meshes->ring.buffer);
+			if (gl_caps.base_instance)
+				glDrawElementsInstancedBaseInstance(GL_TRIANGLES, mesh->index_count, GL_UNSIGNED_SHORT, NULL,
+					(GLsizei)(first[kind + 1] - first[kind]), (GLuint)first[kind]);
+			else
+			{
+				/* no base instance: the instance attributes point at the group itself */
+				gl_state_bind_buffer(GL_ARRAY_BUFFER, meshes->ring.buffer);
+				set_instance_attributes(first[kind] * sizeof(s_mesh_instance));
+				glDrawElementsInstanced(GL_TRIANGLES, mesh->index_count, GL_UNSIGNED_SHORT, NULL,
+					(GLsizei)(first[kind + 1] - first[kind]));
+			}
+			++meshes->draw_calls;
+		}
+		/* fenced per batch, so that the space of a large batch comes back as soon as it is drawn */
+		gpu_ring_fence(&meshes->ring);
+		meshes->drawn += (long)meshes->count;
+	}
+	meshes->count = 0;
+	meshes->kind_count = 0;
+	meshes->last_kind = 0;
+}
+
+void	meshes_end(s_meshes* meshes)
+{
+	meshes_flush(meshes);
+}
+
+void	mesh_instance_place(s_mesh_instance* instance, float const position[3], float scale, float angle)
+{
+	float c = cosf(angle) * scale;
+	float s = sinf(angle) * scale;
+
+	instance->transform[0][0] = c;   instance->transform[0][1] = 0.f;   instance->transform[0][2] = s;   instance->transform[0][3] = position[0];
+	instance->transform[1][0] = 0.f; instance->transform[1][1] = scale; instance->transform[1][2] = 0.f; instance->transform[1][3] = position[1];
+	instance->transform[2][0] = -s;  instance->transform[2][1] = 0.f;   instance->transform[2][2] = c;   instance->transform[2][3] = position[2];
+}
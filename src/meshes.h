@@ -0,0 +1,120 @@
+#ifndef MESHES_H
+#define MESHES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <glad/glad.h>
+
+#include "draw_commands.h"
+#include "gpu_ring.h"
+#include "mat4.h"
+
+/*
+**	Instanced mesh rendering: many copies of a few meshes (glyphs, markers,
+**	props), each with its own transform and color. Instances are queued up
+**	between `meshes_begin()` and `meshes_end()`, grouped by mesh with a
+**	counting sort straight into a ring buffer, and each group is drawn with
+**	a single `glDrawElementsInstanced*()` call.
+*/
+
+//! The most distinct meshes in one batch: past this, the batch is flushed early
+#define MESHES_MAX_KINDS	256
+
+//! The default amount of instances in one batch: past this, the batch is flushed early
+#define MESHES_DEFAULT_BATCH	65536
+
+//! A vertex of a mesh
+typedef struct mesh_vertex
+{
+	float	position[3];
+	float	normal[3];
+}	s_mesh_vertex;
+
+//! A mesh which can be drawn many times, with static vertex and index buffers
+typedef struct mesh
+{
+	GLuint	vertex_array;	//!< Holds the mesh's buffers, and the per-instance attributes (from the batch's ring)
+	GLuint	buffers[2];		//!< The vertex buffer and the index buffer
+	GLsizei	index_count;
+}	s_mesh;
+
+//! The built-in meshes
+typedef enum mesh_shape
+{
+	MESH_SHAPE_CUBE,		//!< A cube, from -0.5 to 0.5
+	MESH_SHAPE_OCTAHEDRON,	//!< A diamond-like marker, of radius 0.5
+	MESH_SHAPE_QUAD,		//!< A flat square in the XY plane, from -0.5 to 0.5, facing +Z (for glyphs)
+	ENUMLENGTH_MESH_SHAPE
+}	e_mesh_shape;
+
+//! One copy of a mesh, as stored in the instance buffer (52 bytes, tightly packed)
+typedef struct mesh_instance
+{
+	float	transform[3][4];	//!< The first 3 rows of the model matrix (the last one is always 0, 0, 0, 1)
+	uint8_t	color[4];			//!< The RGBA color (255 is 1.0)
+}	s_mesh_instance;
+
+//! The instanced mesh renderer, and the instances queued up since `meshes_begin()`
+typedef struct meshes
+{
+	s_gpu_ring			ring;		//!< The instance buffer, which holds the sorted instances of the last few batches
+	GLuint				program;
+	GLint				view_projection_location;
+	s_mat4				view_projection;
+	s_mesh_instance*	queue;		//!< The instances queued up since the last flush, in submission order
+	uint8_t*			keys;		//!< The index in `kinds` of each queued instance
+	size_t				count;		//!< The amount of queued instances
+	size_t				batch;		//!< The amount of instances which `queue` and `keys` can hold
+	s_mesh*				kinds[MESHES_MAX_KINDS];	//!< The distinct meshes which are queued
+	int					kind_count;
+	int					last_kind;	//!< The kind of the last queued instance: usually the same as the next one
+	long				draw_calls;	//!< The amount of draw calls since `meshes_begin()`
+	long				drawn;		//!< The amount of instances drawn since `meshes_begin()`
+}	s_meshes;
+
+//! Creates a mesh from its vertices and triangle indices, returns `0` on success
+int		mesh_create(s_mesh* mesh, s_mesh_vertex const* vertices, size_t vertex_count,
+			uint16_t const* indices, size_t index_count);
+//! Creates one of the built-in meshes, returns `0` on success
+int		mesh_create_shape(s_mesh* mesh, e_mesh_shape shape);
+//! Creates a single mesh which holds all of the built-in meshes, for indirect draws, returns `0` on success
+/*!
+**	@param mesh		The mesh to create: drawing it whole makes little sense
+**	@param ranges	Receives where each of the built-in meshes lies in it, by `e_mesh_shape`
+*/
+int		mesh_create_shapes(s_mesh* mesh, s_draw_range ranges[ENUMLENGTH_MESH_SHAPE]);
+//! Deletes the buffers of a mesh
+void	mesh_free(s_mesh* mesh);
+//! Binds the vertex array of a mesh, with its per-instance attributes read from `buffer` (an array of `s_mesh_instance`)
+void	mesh_bind_instances(s_mesh* mesh, GLuint buffer);
+
+//! Creates the instance buffer and the program, returns `0` on success
+/*!
+**	@param meshes	The instanced mesh renderer to set up
+**	@param batch	The most instances to sort and draw at once (`0` for `MESHES_DEFAULT_BATCH`):
+**					the instance buffer holds `GPU_RING_FRAMES` batches
+*/
+int		meshes_init(s_meshes* meshes, size_t batch);
+//! Deletes the instance buffer, the program and the queue
+void	meshes_free(s_meshes* meshes);
+
+//! Starts a new batch, seen through the given view-projection matrix
+void	meshes_begin(s_meshes* meshes, s_mat4 const* view_projection);
+//! Queues up an instance of `mesh`, and returns it so that the caller fills it in (the batch is flushed first, if it is full)
+s_mesh_instance*	meshes_add(s_meshes* meshes, s_mesh* mesh);
+//! Queues up `count` instances of `mesh` at once, and returns the first of them (`NULL` if `count` is more than the batch size)
+/*!
+**	The instances are contiguous, so that they can be filled in later, from other threads: they stay valid
+**	until the batch is flushed, by `meshes_flush()`, `meshes_end()`, or a later `meshes_add*()` which does not fit.
+*/
+s_mesh_instance*	meshes_add_many(s_meshes* meshes, s_mesh* mesh, size_t count);
+//! Draws all of the queued instances
+void	meshes_flush(s_meshes* meshes);
+//! Draws all of the queued instances, and ends the batch
+void	meshes_end(s_meshes* meshes);
+
+//! Sets the transform of an instance to a translation, uniform scale, and rotation around the Y axis (in radians)
+void	mesh_instance_place(s_mesh_instance* instance, float const position[3], float scale, float angle);
+
+#endif
@@ -0,0 +1,254 @@
+
+#include <stdio.h>
+#include <string.h>
+
+#include "readback.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+
+//! Hands the frames to the consumer, in the order they were captured, until the readback is freed
+static void*	consumer_run(void* data)
+{
+	s_readback* readback = (s_readback*)data;
+	s_readback_slot* slot;
+	s_readback_frame frame;
+	int next = 0;
+
+	frame.width = readback->width;
+	frame.height = readback->height;
+	frame.stride = (size_t)readback->width * 4;
+	pthread_mutex_lock(&readback->lock);
+	for (;;)
+	{
+		slot = &readback->slots[next];
+		while (atomic_load(&slot->state) != READBACK_MAPPED && !readback->quit)
+			pthread_cond_wait(&readback->mapped, &readback->lock);
+		if (atomic_load(&slot->state) != READBACK_MAPPED)
+			break;
+		pthread_mutex_unlock(&readback->lock);
+		frame.pixels = slot->mapped;
+		frame.index = slot->index;
+		/* a frame which couldn't be mapped is skipped */
+		if (frame.pixels)
+			readback->consume(readback->user, &frame);
+		pthread_mutex_lock(&readback->lock);
+		atomic_store(&slot->state, READBACK_CONSUMED);
+		pthread_cond_broadcast(&readback->consumed);
+		next = (next + 1) % readback->slot_count;
+	}
+	pthread_mutex_unlock(&readback->lock);
+	return NULL;
+}
+
+//! Creates the buffers of the ring (mapped for good, if the driver can), returns `0` on success
+static int	create_buffers(s_readback* readback)
+{
+	GLbitfield const flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	s_readback_slot* slot;
+	int i;
+
+	readback->persistent = gl_caps.buffer_storage;
+	for (i = 0; i < readback->slot_count; ++i)
+	{
+		slot = &readback->slots[i];
+		glGenBuffers(1, &slot->buffer);
+		gl_state_bind_buffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+		if (!readback->persistent)
+		{
+			glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)readback->size, NULL, GL_STREAM_READ);
+			continue;
+		}
+		/* the CPU reads it: it had better live in system memory */
+		glBufferStorage(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)readback->size, NULL, flags | GL_CLIENT_STORAGE_BIT);
+		if (!(slot->mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)readback->size, flags)))
+			break;
+	}
+	gl_state_bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+	return (i == readback->slot_count ? 0 : -1);
+}
+
+//! Deletes the buffers of the ring (which unmaps them)
+static void	delete_buffers(s_readback* readback)
+{
+	int i;
+
+	for (i = 0; i < readback->slot_count; ++i)
+	{
+		if (readback->slots[i].fence)
+			glDeleteSync(readback->slots[i].fence);
+		if (readback->slots[i].buffer)
+			gl_state_delete_buffers(1, &readback->slots[i].buffer);
+	}
+}
+
+int		readback_init(s_readback* readback, int width, int height, int slots,
+	void (*consume)(void* user, s_readback_frame const* frame), void* user)
+{
+	int i;
+
+	memset(readback, 0, sizeof(s_readback));
+	if (slots < 1 || slots > READBACK_MAX_SLOTS || width <= 0 || height <= 0)
+	{
+		fprintf(stderr, "error: a readback ring needs 1 to %d buffers, of a nonempty size\n", READBACK_MAX_SLOTS);
+		return -1;
+	}
+	readback->slot_count = slots;
+	readback->width = width;
+	readback->height = height;
+	readback->size = (size_t)width * (size_t)height * 4;
+	readback->consume = consume;
+	readback->user = user;
+	for (i = 0; i < slots; ++i)
+		atomic_init(&readback->slots[i].state, READBACK_FREE);
+	if (create_buffers(readback))
+	{
+		fprintf(stderr, "error: could not create the readback buffers\n");
+		delete_buffers(readback);
+		return -1;
+	}
+	pthread_mutex_init(&readback->lock, NULL);
+	pthread_cond_init(&readback->mapped, NULL);
+	pthread_cond_init(&readback->consumed, NULL);
+	if (pthread_create(&readback->consumer, NULL, consumer_run, readback))
+	{
+		fprintf(stderr, "error: could not start the readback consumer thread\n");
+		pthread_mutex_destroy(&readback->lock);
+		pthread_cond_destroy(&readback->mapped);
+		pthread_cond_destroy(&readback->consumed);
+		delete_buffers(readback);
+		return -1;
+	}
+	return 0;
+}
+
+//! Hands a pending slot to the consumer once its read is done, returns `0` if it was handed over
+/*!
+**	@param wait	If nonzero, the GPU is waited for, otherwise `-1` is returned if it isn't done yet
+*/
+static int	hand_over(s_readback* readback, s_readback_slot* slot, int wait)
+{
+	if (glClientWaitSync(slot->fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+	{
+		if (!wait)
+			return -1;
+		++readback->waits;
+		while (glClientWaitSync(slot->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000u) == GL_TIMEOUT_EXPIRED)
+			;
+	}
+	glDeleteSync(slot->fence);
+	slot->fence = NULL;
+	if (!readback->persistent)
+	{
+		gl_state_bind_buffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+		slot->mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)readback->size, GL_MAP_READ_BIT);
+		gl_state_bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+	}
+	pthread_mutex_lock(&readback->lock);
+	atomic_store(&slot->state, READBACK_MAPPED);
+	pthread_cond_signal(&readback->mapped);
+	pthread_mutex_unlock(&readback->lock);
+	return 0;
+}
+
+//! Makes a slot which the consumer is done with free again, unmapping it if it isn't mapped for good
+static void	release(s_readback* readback, s_readback_slot* slot)
+{
+	if (!readback->persistent && slot->mapped)
+	{
+		gl_state_bind_buffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		gl_state_bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+		slot->mapped = NULL;
+	}
+	atomic_store(&slot->state, READBACK_FREE);
+}
+
+void	readback_poll(s_readback* readback)
+{
+	s_readback_slot* slot = &readback->slots[readback->collect];
+
+	/* the pending slots follow each other, oldest first */
+	while (atomic_load(&slot->state) == READBACK_PENDING && hand_over(readback, slot, 0) == 0)
+	{
+		readback->collect = (readback->collect + 1) % readback->slot_count;
+		slot = &readback->slots[readback->collect];
+	}
+}
+
+int		readback_capture(s_readback* readback, GLuint framebuffer)
+{
+	s_readback_slot* slot = &readback->slots[readback->head];
+
+	readback_poll(readback);
+	/* the GPU is `slots - 1` frames behind: this is the oldest pending frame, which is needed now */
+	if (atomic_load(&slot->state) == READBACK_PENDING)
+	{
+		hand_over(readback, slot, 1);
+		readback->collect = (readback->collect + 1) % readback->slot_count;
+	}
+	if (atomic_load(&slot->state) == READBACK_MAPPED && readback->lossless)
+	{
+		++readback->waits;
+		pthread_mutex_lock(&readback->lock);
+		while (atomic_load(&slot->state) == READBACK_MAPPED)
+			pthread_cond_wait(&readback->consumed, &readback->lock);
+		pthread_mutex_unlock(&readback->lock);
+	}
+	if (atomic_load(&slot->state) == READBACK_MAPPED)
+	{
+		++readback->dropped;
+		return 0;
+	}
+	if (atomic_load(&slot->state) == READBACK_CONSUMED)
+		release(readback, slot);
+	gl_state_bind_framebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	gl_state_bind_buffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	/* into the buffer: this returns without waiting for the frame to be rendered */
+	glReadPixels(0, 0, readback->width, readback->height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	gl_state_bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+	slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	slot->index = readback->captured++;
+	atomic_store(&slot->state, READBACK_PENDING);
+	readback->head = (readback->head + 1) % readback->slot_count;
+	return 1;
+}
+
+void	readback_finish(s_readback* readback)
+{
+	s_readback_slot* slot = &readback->slots[readback->collect];
+	int i;
+
+	while (atomic_load(&slot->state) == READBACK_PENDING)
+	{
+		hand_over(readback, slot, 1);
+		readback->collect = (readback->collect + 1) % readback->slot_count;
+		slot = &readback->slots[readback->collect];
+	}
+	pthread_mutex_lock(&readback->lock);
+	for (i = 0; i < readback->slot_count; ++i)
+	{
+		while (atomic_load(&readback->slots[i].state) == READBACK_MAPPED)
+			pthread_cond_wait(&readback->consumed, &readback->lock);
+	}
+	pthread_mutex_unlock(&readback->lock);
+	for (i = 0; i < readback->slot_count; ++i)
+	{
+		if (atomic_load(&readback->slots[i].state) == READBACK_CONSUMED)
+			release(readback, &readback->slots[i]);
+	}
+}
+
+void	readback_free(s_readback* readback)
+{
+	readback_finish(readback);
+	pthread_mutex_lock(&readback->lock);
+	readback->quit = 1;
+	pthread_cond_signal(&readback->mapped);
+	pthread_mutex_unlock(&readback->lock);
+	pthread_join(readback->consumer, NULL);
+	pthread_mutex_destroy(&readback->lock);
+	pthread_cond_destroy(&readback->mapped);
+	pthread_cond_destroy(&readback->consumed);
+	delete_buffers(readback);
+}
@@ -0,0 +1,112 @@
+#ifndef READBACK_H
+#define READBACK_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+#include <pthread.h>
+
+#include <glad/glad.h>
+
+/*
+**	Reads rendered frames back to the CPU without stalling the renderer, to
+**	record or stream them. Each frame is read into the next of a ring of
+**	`GL_PIXEL_PACK_BUFFER`s, with `glReadPixels()` (which then returns right
+**	away), and fenced. The buffer is only mapped once its fence is signaled,
+**	usually a few frames later, and its mapping is handed as it is to a
+**	consumer thread, through a callback: no copy is made on the way.
+**	With `GL_ARB_buffer_storage` the buffers stay mapped for their whole
+**	life, otherwise each one is mapped and unmapped by the render thread.
+**	If the consumer falls behind, so that no buffer is free when a frame is
+**	captured, that frame is dropped rather than stalling the renderer (unless
+**	the readback is lossless, for offline rendering).
+*/
+
+//! The most buffers in a ring
+#define READBACK_MAX_SLOTS	8
+
+//! Where a buffer of the ring is at
+typedef enum readback_state
+{
+	READBACK_FREE,		//!< Can be read into
+	READBACK_PENDING,	//!< Read into by the GPU, up to its fence
+	READBACK_MAPPED,	//!< Handed to the consumer thread
+	READBACK_CONSUMED,	//!< Done with by the consumer thread (it may have to be unmapped by the render thread)
+	ENUMLENGTH_READBACK_STATE
+}	e_readback_state;
+
+//! A frame which was read back, as given to the consumer
+typedef struct readback_frame
+{
+	void const*	pixels;	//!< The RGBA bytes, bottom row first (as `glReadPixels()` gives them): only valid during the callback
+	int			width;
+	int			height;
+	size_t		stride;	//!< The amount of bytes from one row to the next
+	long		index;	//!< The index of the frame among the captured ones (dropped frames leave gaps)
+}	s_readback_frame;
+
+//! A buffer of the ring
+typedef struct readback_slot
+{
+	GLuint		buffer;
+	GLsync		fence;		//!< Placed after the read into `buffer`
+	void*		mapped;		//!< The mapping of `buffer`, while it is mapped
+	long		index;		//!< The index of the frame which was read into it
+	atomic_int	state;		//!< An `e_readback_state`
+}	s_readback_slot;
+
+//! The ring of pixel buffers, and the consumer thread
+typedef struct readback
+{
+	s_readback_slot	slots[READBACK_MAX_SLOTS];
+	int				slot_count;
+	int				width;		//!< The size of the captured frames, in pixels
+	int				height;
+	size_t			size;		//!< The size of a frame, in bytes
+	int				persistent;	//!< Nonzero if the buffers are mapped for their whole life
+	int				lossless;	//!< If nonzero, capturing waits for the consumer rather than dropping frames (set it after `readback_init()`)
+	int				head;		//!< The slot which the next frame is read into
+	int				collect;	//!< The oldest slot which may be pending
+	long			captured;	//!< The amount of frames which were read into the ring
+	long			dropped;	//!< The amount of frames which were not captured, since the consumer was behind
+	long			waits;		//!< The amount of times the render thread had to wait for the GPU (or for the consumer, if lossless)
+	void			(*consume)(void* user, s_readback_frame const* frame);	//!< Called on the consumer thread, for each frame
+	void*			user;		//!< Given to `consume`
+	pthread_t		consumer;
+	pthread_mutex_t	lock;		//!< Protects `quit`, and the consumer's sleep
+	pthread_cond_t	mapped;		//!< Signaled when a frame is handed to the consumer, or when it must quit
+	pthread_cond_t	consumed;	//!< Signaled when the consumer is done with a frame
+	int				quit;
+}	s_readback;
+
+//! Creates the ring of pixel buffers, and starts the consumer thread, returns `0` on success
+/*!
+**	@param readback	The readback to set up
+**	@param width	The size of the frames to capture, in pixels
+**	@param height
+**	@param slots	The amount of buffers in the ring (at most `READBACK_MAX_SLOTS`): a frame is mapped
+**					`slots - 1` frames after it is captured, at the latest
+**	@param consume	Called on the consumer thread with each frame, in order
+**	@param user		Given to `consume`
+*/
+int		readback_init(s_readback* readback, int width, int height, int slots,
+			void (*consume)(void* user, s_readback_frame const* frame), void* user);
+//! Hands every captured frame to the consumer and waits for it to be done, then stops it and deletes the buffers
+void	readback_free(s_readback* readback);
+
+//! Captures the frame which was just rendered into `framebuffer`, without waiting for the GPU
+/*!
+**	Frames whose reads are done are handed to the consumer first. If the buffer
+**	which the frame goes into is still being read into, the GPU is waited for
+**	(it is `slots - 1` frames behind); if the consumer still has it, the frame is dropped,
+**	or the consumer is waited for if the readback is `lossless`.
+**	@returns
+**	`1` if the frame was captured, `0` if it was dropped
+*/
+int		readback_capture(s_readback* readback, GLuint framebuffer);
+//! Hands the frames whose reads are done to the consumer, without waiting (`readback_capture()` does it too)
+void	readback_poll(s_readback* readback);
+//! Waits until every captured frame was handed to the consumer, and the consumer is done with them
+void	readback_finish(s_readback* readback);
+
+#endif
@@ -0,0 +1,108 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "render_thread.h"
+
+//! Waits for a snapshot, and takes it, returns its index, or `-1` if the thread must quit
+static int	take(s_render_thread* thread)
+{
+	int slot;
+
+	while ((slot = atomic_exchange(&thread->published, -1)) < 0)
+	{
+		/* `sleeping` is set before `published` is checked again: the main thread sees one or the other */
+		pthread_mutex_lock(&thread->lock);
+		atomic_store(&thread->sleeping, 1);
+		while (atomic_load(&thread->published) < 0 && !atomic_load(&thread->quit))
+			pthread_cond_wait(&thread->wake, &thread->lock);
+		atomic_store(&thread->sleeping, 0);
+		pthread_mutex_unlock(&thread->lock);
+		if (atomic_load(&thread->quit))
+			return -1;
+	}
+	return slot;
+}
+
+static void*	render_run(void* data)
+{
+	s_render_thread* thread = (s_render_thread*)data;
+	int slot;
+
+	window_make_current(thread->window);
+	while (!atomic_load(&thread->quit) && (slot = take(thread)) >= 0)
+	{
+		/* the main thread may fill in the other snapshot meanwhile: wake it up to do so */
+		window_post_empty_event();
+		thread->render(thread->user, thread->snapshots + (size_t)slot * thread->snapshot_size);
+		atomic_fetch_add(&thread->rendered, 1);
+		/* and again, for whoever waits for the frame to be rendered */
+		window_post_empty_event();
+	}
+	window_make_current(NULL);
+	return NULL;
+}
+
+int		render_thread_start(s_render_thread* thread, s_window* window, size_t size,
+	void (*render)(void* user, void const* snapshot), void* user)
+{
+	memset(thread, 0, sizeof(s_render_thread));
+	if (!(thread->snapshots = (unsigned char*)calloc(2, size)))
+	{
+		fprintf(stderr, "error: could not allocate the frame snapshots\n");
+		return -1;
+	}
+	thread->window = window;
+	thread->render = render;
+	thread->user = user;
+	thread->snapshot_size = size;
+	atomic_init(&thread->published, -1);
+	pthread_mutex_init(&thread->lock, NULL);
+	pthread_cond_init(&thread->wake, NULL);
+	/* a context can only be current on one thread at a time */
+	window_make_current(NULL);
+	if (pthread_create(&thread->thread, NULL, render_run, thread))
+	{
+		fprintf(stderr, "error: could not start the render thread\n");
+		window_make_current(window);
+		pthread_mutex_destroy(&thread->lock);
+		pthread_cond_destroy(&thread->wake);
+		free(thread->snapshots);
+		return -1;
+	}
+	return 0;
+}
+
+void	render_thread_stop(s_render_thread* thread)
+{
+	pthread_mutex_lock(&thread->lock);
+	atomic_store(&thread->quit, 1);
+	pthread_cond_broadcast(&thread->wake);
+	pthread_mutex_unlock(&thread->lock);
+	pthread_join(thread->thread, NULL);
+	window_make_current(thread->window);
+	pthread_mutex_destroy(&thread->lock);
+	pthread_cond_destroy(&thread->wake);
+	free(thread->snapshots);
+	thread->snapshots = NULL;
+}
+
+void*	render_thread_snapshot(s_render_thread* thread)
+{
+	if (atomic_load(&thread->published) >= 0)
+		return NULL;
+	return thread->snapshots + (size_t)thread->write_slot * thread->snapshot_size;
+}
+
+void	render_thread_publish(s_render_thread* thread)
+{
+	atomic_store(&thread->published, thread->write_slot);
+	thread->write_slot ^= 1;
+	if (atomic_load(&thread->sleeping))
+	{
+		pthread_mutex_lock(&thread->lock);
+		pthread_cond_signal(&thread->wake);
+		pthread_mutex_unlock(&thread->lock);
+	}
+}
@@ -0,0 +1,61 @@
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+#include <pthread.h>
+
+#include "window.h"
+
+/*
+**	A thread which owns the GL context, and renders (and swaps) frames, so
+**	that the main thread is left to handle the window's events and to
+**	simulate: a slow frame or a blocking swap no longer holds events up.
+**	The main thread describes each frame in a snapshot (whatever the render
+**	callback needs, copied by value), and hands it over: there are two
+**	snapshots, one which the render thread reads while the main thread
+**	writes the other, and they are swapped with a single atomic exchange,
+**	without a lock. The main thread may only write a snapshot once the render
+**	thread took the last one, which it is told of with
+**	`window_post_empty_event()`: the simulation runs at most one frame ahead.
+**	Window system calls which must be made on the main thread (events, the
+**	title, the framebuffer size with GLFW) stay out of the render callback.
+*/
+
+//! The render thread, and the snapshots which it is handed
+typedef struct render_thread
+{
+	s_window*		window;
+	pthread_t		thread;
+	void			(*render)(void* user, void const* snapshot);	//!< Renders and presents the frame which a snapshot describes
+	void*			user;
+	unsigned char*	snapshots;		//!< The two snapshots, one after the other
+	size_t			snapshot_size;
+	int				write_slot;		//!< The snapshot which the main thread writes next
+	atomic_int		published;		//!< The snapshot handed to the render thread, or -1 once it took it
+	atomic_int		quit;
+	atomic_int		sleeping;		//!< Nonzero while the render thread waits for a snapshot
+	pthread_mutex_t	lock;			//!< Only protects the render thread's sleep
+	pthread_cond_t	wake;			//!< Signaled when a snapshot is handed over, or when the thread must quit
+	atomic_long		rendered;		//!< The amount of snapshots which were rendered
+}	s_render_thread;
+
+//! Hands the context of `window` over to a new render thread, returns `0` on success
+/*!
+**	@param thread	The render thread to start
+**	@param window	The window whose context is current on the calling thread: it is released
+**	@param size		The size of a snapshot, in bytes
+**	@param render	Called on the render thread for each snapshot which is handed over, with `user`
+*/
+int		render_thread_start(s_render_thread* thread, s_window* window, size_t size,
+			void (*render)(void* user, void const* snapshot), void* user);
+//! Stops the render thread once it is done with the frame it renders, and makes the context current on the calling thread again
+void	render_thread_stop(s_render_thread* thread);
+
+//! Returns the snapshot to fill in for the next frame, or `NULL` if the render thread did not take the last one yet
+void*	render_thread_snapshot(s_render_thread* thread);
+//! Hands the snapshot returned by `render_thread_snapshot()` over to the render thread
+void	render_thread_publish(s_render_thread* thread);
+
+#endif
@@ -0,0 +1,218 @@
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <glad/glad.h>
+
+#include "ecs.h"
+#include "gl_state.h"
+#include "meshes.h"
+#include "scenes/scenes.h"
+
+/*
+**	The instancing stress scene: 100k markers (cubes, diamonds and flat
+**	glyphs) on a 50x50x40 grid, each spinning, seen from an orbiting camera.
+**	The markers are entities, whose mesh is a tag: each mesh's markers are
+**	stored apart, in chunks. The instances of each mesh are queued up at
+**	once, then filled in by jobs (a few chunks each), on every core, before
+**	they are drawn on the main thread.
+*/
+
+#define GRID_X	50
+#define GRID_Y	40
+#define GRID_Z	50
+#define SPACING	1.5f
+#define COUNT	(GRID_X * GRID_Y * GRID_Z)
+//! The least chunks which a job fills in the instances of
+#define GRAIN	2
+
+//! A chunk of markers, and the instances which they fill in
+typedef struct instances_part
+{
+	s_ecs_chunk*		chunk;
+	s_mesh_instance*	instances;
+}	s_instances_part;
+
+typedef struct scene_instances
+{
+	s_meshes			meshes;
+	s_mesh				shapes[ENUMLENGTH_MESH_SHAPE];
+	s_jobs*				jobs;
+	s_ecs				ecs;
+	s_instances_part*	parts;		//!< The chunks of every mesh's markers, in this frame
+	size_t				part_capacity;
+	float				time;
+}	s_scene_instances;
+
+//! Creates the markers, in grid order: the meshes take turns along it
+static int	create_markers(s_ecs* ecs)
+{
+	s_ecs_transform* transform;
+	s_ecs_color* color;
+	t_ecs_entity entity;
+	int x, y, z;
+	int i;
+
+	for (i = 0; i < COUNT; ++i)
+	{
+		entity = ecs_create(ecs, ECS_BIT(ECS_TRANSFORM) | ECS_BIT(ECS_SPIN) | ECS_BIT(ECS_COLOR) |
+			ECS_BIT(ECS_MESH + i % ENUMLENGTH_MESH_SHAPE));
+		if (entity == ECS_NONE)
+			return -1;
+		x = i % GRID_X;
+		z = i / GRID_X % GRID_Z;
+		y = i / (GRID_X * GRID_Z);
+		transform = (s_ecs_transform*)ecs_get(ecs, entity, ECS_TRANSFORM);
+		transform->position[0] = ((float)x - GRID_X / 2) * SPACING;
+		transform->position[1] = ((float)y - GRID_Y / 2) * SPACING;
+		transform->position[2] = ((float)z - GRID_Z / 2) * SPACING;
+		transform->scale = 0.8f;
+		transform->angle = (float)(x * 7 + z * 3) * 0.1f;
+		*(float*)ecs_get(ecs, entity, ECS_SPIN) = 1.f;
+		color = (s_ecs_color*)ecs_get(ecs, entity, ECS_COLOR);
+		color->rgba[0] = (uint8_t)(x * 255 / GRID_X);
+		color->rgba[1] = (uint8_t)(y * 255 / GRID_Y);
+		color->rgba[2] = (uint8_t)(z * 255 / GRID_Z);
+		color->rgba[3] = 255;
+	}
+	return 0;
+}
+
+void*	scene_instances_create(s_config const* config, s_jobs* jobs)
+{
+	s_scene_instances* scene = (s_scene_instances*)calloc(1, sizeof(s_scene_instances));
+	int i;
+
+	(void)config;
+	if (!scene)
+		return NULL;
+	scene->jobs = jobs;
+	ecs_init(&scene->ecs);
+	if (create_markers(&scene->ecs))
+	{
+		ecs_free(&scene->ecs);
+		free(scene);
+		return NULL;
+	}
+	if (meshes_init(&scene->meshes, COUNT))
+	{
+		ecs_free(&scene->ecs);
+		free(scene);
+		return NULL;
+	}
+	for (i = 0; i < ENUMLENGTH_MESH_SHAPE; ++i)
+		mesh_create_shape(&scene->shapes[i], (e_mesh_shape)i);
+	return scene;
+}
+
+//! Fills in the instances of the chunks from `begin` to `end` (excluded)
+static void	fill_instances(void* data, size_t begin, size_t end)
+{
+	s_scene_instances* scene = (s_scene_instances*)data;
+	s_ecs_transform const* transforms;
+	s_ecs_color const* colors;
+	s_mesh_instance* instance;
+	float const* spins;
+	uint32_t row;
+	size_t i;
+
+	for (i = begin; i < end; ++i)
+	{
+		transforms = (s_ecs_transform const*)ecs_column(scene->parts[i].chunk, ECS_TRANSFORM);
+		spins = (float const*)ecs_column(scene->parts[i].chunk, ECS_SPIN);
+		colors = (s_ecs_color const*)ecs_column(scene->parts[i].chunk, ECS_COLOR);
+		instance = scene->parts[i].instances;
+		for (row = 0; row < scene->parts[i].chunk->count; ++row, ++instance)
+		{
+			mesh_instance_place(instance, transforms[row].position, transforms[row].scale,
+				transforms[row].angle + spins[row] * scene->time);
+			instance->color[0] = colors[row].rgba[0];
+			instance->color[1] = colors[row].rgba[1];
+			instance->color[2] = colors[row].rgba[2];
+			instance->color[3] = colors[row].rgba[3];
+		}
+	}
+}
+
+//! Lists the chunks of every mesh's markers, and queues their instances up, returns the amount of chunks, or `0` on failure
+static size_t	queue_instances(s_scene_instances* scene)
+{
+	s_mesh_instance* instances;
+	s_instances_part* parts;
+	s_ecs_query query;
+	s_ecs_chunk* chunk;
+	uint32_t mask;
+	size_t first, count = 0;
+	size_t capacity;
+	size_t total;
+	int shape;
+
+	for (shape = 0; shape < ENUMLENGTH_MESH_SHAPE; ++shape)
+	{
+		mask = ECS_BIT(ECS_TRANSFORM) | ECS_BIT(ECS_SPIN) | ECS_BIT(ECS_COLOR) | ECS_BIT(ECS_MESH + shape);
+		capacity = count + ecs_chunks(&scene->ecs, mask, NULL, 0);
+		if (capacity > scene->part_capacity)
+		{
+			if (!(parts = (s_instances_part*)realloc(scene->parts, capacity * sizeof(s_instances_part))))
+				return 0;
+			scene->parts = parts;
+			scene->part_capacity = capacity;
+		}
+		first = count;
+		total = 0;
+		ecs_query_init(&query, &scene->ecs, mask);
+		while ((chunk = ecs_query_next(&query)))
+		{
+			scene->parts[count++].chunk = chunk;
+			total += chunk->count;
+		}
+		if (total == 0)
+			continue;
+		/* each chunk fills in its own run of the mesh's instances */
+		if (!(instances = meshes_add_many(&scene->meshes, &scene->shapes[shape], total)))
+			return 0;
+		for (; first < count; ++first)
+		{
+			scene->parts[first].instances = instances;
+			instances += scene->parts[first].chunk->count;
+		}
+	}
+	return count;
+}
+
+void	scene_instances_draw(void* data, int width, int height, double time)
+{
+	static float const	up[3] = { 0.f, 1.f, 0.f };
+	static float const	target[3] = { 0.f, 0.f, 0.f };
+	s_scene_instances* scene = (s_scene_instances*)data;
+	s_mat4 projection, view;
+	float eye[3];
+	size_t parts;
+
+	eye[0] = 90.f * (float)cos(time * 0.2);
+	eye[1] = 40.f;
+	eye[2] = 90.f * (float)sin(time * 0.2);
+	mat4_perspective(&projection, 0.8f, (float)width / (float)(height > 0 ? height : 1), 0.5f, 300.f);
+	mat4_look_at(&view, eye, target, up);
+	mat4_multiply(&projection, &projection, &view);
+	gl_state_viewport(0, 0, width, height);
+	meshes_begin(&scene->meshes, &projection);
+	/* the whole grid fits in a batch: the instances are queued up first, filled in by the jobs, then drawn */
+	parts = queue_instances(scene);
+	scene->time = (float)time;
+	jobs_parallel_for(scene->jobs, parts, GRAIN, fill_instances, scene);
+	meshes_end(&scene->meshes);
+}
+
+void	scene_instances_destroy(void* data)
+{
+	s_scene_instances* scene = (s_scene_instances*)data;
+	int i;
+
+	for (i = 0; i < ENUMLENGTH_MESH_SHAPE; ++i)
+		mesh_free(&scene->shapes[i]);
+	meshes_free(&scene->meshes);
+	ecs_free(&scene->ecs);
+	free(scene->parts);
+	free(scene);
+}
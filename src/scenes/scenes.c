@@ -0,0 +1,27 @@
+
+#include <stdio.h>
+#include <string.h>
+
+#include "scenes/scenes.h"
+
+static s_scene const	scenes[] =
+{
+	{ "instances", scene_instances_create, scene_instances_draw, scene_instances_destroy },
+};
+#define SCENES	(sizeof(scenes) / sizeof(scenes[0]))
+
+s_scene const*	scene_find(char const* name)
+{
+	size_t i;
+
+	for (i = 0; i < SCENES; ++i)
+	{
+		if (strcmp(name, scenes[i].name) == 0)
+			return &scenes[i];
+	}
+	fprintf(stderr, "error: unknown scene '%s', expected one of: ", name);
+	for (i = 0; i < SCENES; ++i)
+		fprintf(stderr, "%s%s", (i ? ", " : ""), scenes[i].name);
+	fprintf(stderr, "\n");
+	return NULL;
+}
@@ -0,0 +1,23 @@
+#ifndef SCENES_H
+#define SCENES_H
+
+#include "config.h"
+#include "jobs.h"
+
+//! Something for the example to draw, which can be selected on the command-line, with `--scene <name>`
+typedef struct scene
+{
+	char const*	name;	//!< The name given on the command-line to select this scene
+	void*	(*create)(s_config const* config, s_jobs* jobs);	//!< Creates the scene's GL objects, returns its data (or `NULL` on failure): its CPU work may be shared out on `jobs`
+	void	(*draw)(void* data, int width, int height, double time);	//!< Draws a frame, `time` is in seconds
+	void	(*destroy)(void* data);	//!< Deletes the scene's GL objects and data
+}	s_scene;
+
+//! Returns the scene with the given name, or `NULL` (with an error message listing the scenes) if there is none
+s_scene const*	scene_find(char const* name);
+
+void*	scene_instances_create(s_config const* config, s_jobs* jobs);
+void	scene_instances_draw(void* data, int width, int height, double time);
+void	scene_instances_destroy(void* data);
+
+#endif
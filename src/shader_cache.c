@@ -0,0 +1,527 @@
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#endif
+
+#include "shader_cache.h"
+#include "gl_caps.h"
+#include "gl_util.h"
+
+//! The start of each binary file
+typedef struct shader_binary_header
+{
+	char		magic[4];	//!< "GLPB"
+	uint32_t	format;		//!< The driver's binary format
+	uint64_t	driver;		//!< The `driver` hash of the cache which wrote it
+	uint64_t	hash;		//!< The hash of the program's sources
+	uint32_t	length;		//!< The amount of bytes of binary which follow
+	uint32_t	padding;
+}	s_shader_binary_header;
+
+//! Hashes bytes with 64-bit FNV-1a, starting from `hash`
+static uint64_t	fnv1a(uint64_t hash, void const* data, size_t size)
+{
+	uint8_t const* bytes = (uint8_t const*)data;
+	size_t i;
+
+	for (i = 0; i < size; ++i)
+		hash = (hash ^ bytes[i]) * 0x100000001B3u;
+	return hash;
+}
+
+#define FNV1A_START	0xCBF29CE484222325u
+
+//! Returns a copy of `source`, with a `#define` line for each of the defines inserted after its `#version` line
+static char*	preprocess(char const* source, char const* const* defines)
+{
+	char const* body = source;
+	size_t length = strlen(source) + 1;
+	char* result;
+	char* out;
+	int i;
+
+	/* the #version directive must come first: the defines go right after it */
+	if (strncmp(source, "#version", 8) == 0)
+		body = (strchr(source, '\n') ? strchr(source, '\n') + 1 : source + strlen(source));
+	for (i = 0; defines && defines[i]; ++i)
+		length += strlen("#define \n") + strlen(defines[i]);
+	if (!(result = (char*)malloc(length)))
+		return NULL;
+	memcpy(result, source, (size_t)(body - source));
+	out = result + (body - source);
+	for (i = 0; defines && defines[i]; ++i)
+		out += sprintf(out, "#define %s\n", defines[i]);
+	strcpy(out, body);
+	return result;
+}
+
+//! Gives the path of the binary of a program
+static void	binary_path(s_shader_cache const* cache, uint64_t hash, char* path, size_t size)
+{
+	snprintf(path, size, "%s/%016llx.glbin", cache->directory, (unsigned long long)hash);
+}
+
+static int	make_directory(char const* path)
+{
+#if defined(_WIN32)
+	if (_mkdir(path) == 0 || errno == EEXIST)
+		return 0;
+#else
+	if (mkdir(path, 0755) == 0 || errno == EEXIST)
+		return 0;
+#endif
+	fprintf(stderr, "error: could not create the shader cache directory '%s'\n", path);
+	return -1;
+}
+
+//! Loads a program from its binary, returns `0` on success
+static int	load_binary(s_shader_cache* cache, uint64_t hash, GLuint program)
+{
+	s_shader_binary_header header;
+	char path[SHADER_CACHE_PATH];
+	GLint status = GL_FALSE;
+	void* binary = NULL;
+	FILE* file;
+
+	binary_path(cache, hash, path, sizeof(path));
+	if (!(file = fopen(path, "rb")))
+		return -1;
+	if (fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.magic, "GLPB", 4) == 0 &&
+		header.hash == hash && header.driver == cache->driver && (binary = malloc(header.length)) &&
+		fread(binary, 1, header.length, file) == header.length)
+	{
+		glProgramBinary(program, header.format, binary, (GLsizei)header.length);
+		glGetProgramiv(program, GL_LINK_STATUS, &status);
+	}
+	free(binary);
+	fclose(file);
+	/* a binary of another driver (or one which this driver refuses, after an update) is compiled again */
+	if (status != GL_TRUE)
+		++cache->stale;
+	return (status == GL_TRUE ? 0 : -1);
+}
+
+//! Writes the binary of a program, so that the next run needn't compile it
+static void	save_binary(s_shader_cache const* cache, uint64_t hash, GLuint program)
+{
+	s_shader_binary_header header;
+	char path[SHADER_CACHE_PATH];
+	char temporary[SHADER_CACHE_PATH + 4];
+	GLint length = 0;
+	GLenum format;
+	void* binary;
+	FILE* file;
+	int written;
+
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0 || !(binary = malloc((size_t)length)))
+		return;
+	glGetProgramBinary(program, length, &length, &format, binary);
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "GLPB", 4);
+	header.format = format;
+	header.driver = cache->driver;
+	header.hash = hash;
+	header.length = (uint32_t)length;
+	/* written aside and then renamed: a run which is interrupted never leaves a truncated binary */
+	binary_path(cache, hash, path, sizeof(path));
+	snprintf(temporary, sizeof(temporary), "%s.tmp", path);
+	if ((file = fopen(temporary, "wb")))
+	{
+		written = (fwrite(&header, sizeof(header), 1, file) == 1 &&
+			fwrite(binary, 1, (size_t)length, file) == (size_t)length);
+		if (fclose(file) == 0 && written)
+		{
+			remove(path);
+			rename(temporary, path);
+		}
+		else
+			remove(temporary);
+	}
+	free(binary);
+}
+
+//! Compiles and links the queued programs, with a context of its own, until the cache is freed
+static void*	worker_run(void* data)
+{
+	s_shader_cache* cache = (s_shader_cache*)data;
+	s_shader_program* program;
+	GLuint vertex_array;
+	GLuint target[2];
+	GLuint framebuffer;
+	int status;
+
+	window_make_current(cache->worker_window);
+	/* neither are shared: the warm-up draws need a vertex array, and a framebuffer like the window's */
+	glGenVertexArrays(1, &vertex_array);
+	glBindVertexArray(vertex_array);
+	glGenRenderbuffers(2, target);
+	glBindRenderbuffer(GL_RENDERBUFFER, target[0]);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, 1, 1);
+	glBindRenderbuffer(GL_RENDERBUFFER, target[1]);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, 1, 1);
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, target[0]);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, target[1]);
+	glViewport(0, 0, 1, 1);
+	pthread_mutex_lock(&cache->lock);
+	for (;;)
+	{
+		while (!cache->queue && !cache->quit)
+			pthread_cond_wait(&cache->queued, &cache->lock);
+		if (cache->quit)
+			break;
+		program = cache->queue;
+		cache->queue = program->next;
+		pthread_mutex_unlock(&cache->lock);
+		if (cache->directory[0])
+			glProgramParameteri(program->program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		status = (gl_link_program(program->program, program->sources[0], program->sources[1]) == 0 ?
+			SHADER_LINKED : SHADER_FAILED);
+		if (status == SHADER_LINKED && cache->directory[0])
+			save_binary(cache, program->hash, program->program);
+		/* some drivers only finish compiling on the first draw: better here than in a frame */
+		if (status == SHADER_LINKED)
+		{
+			glUseProgram(program->program);
+			glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+			glUseProgram(0);
+		}
+		/* the renderer's context may only use the program once the link is complete */
+		glFinish();
+		pthread_mutex_lock(&cache->lock);
+		atomic_store(&program->status, status);
+		pthread_cond_broadcast(&cache->linked);
+	}
+	pthread_mutex_unlock(&cache->lock);
+	glDeleteFramebuffers(1, &framebuffer);
+	glDeleteRenderbuffers(2, target);
+	glDeleteVertexArrays(1, &vertex_array);
+	window_make_current(NULL);
+	return NULL;
+}
+
+//! Starts the worker thread, with a context which shares objects with the one of `window`, returns `0` on success
+static int	start_worker(s_shader_cache* cache, s_window* window)
+{
+	if (!(cache->worker_window = window_create_shared(window)))
+		return -1;
+	if (pthread_create(&cache->worker, NULL, worker_run, cache))
+	{
+		window_destroy(cache->worker_window);
+		cache->worker_window = NULL;
+		return -1;
+	}
+	return 0;
+}
+
+int		shader_cache_init(s_shader_cache* cache, char const* directory, s_window* window)
+{
+	static GLenum const	strings[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+	char const* value;
+	size_t i;
+
+	memset(cache, 0, sizeof(s_shader_cache));
+	cache->driver = FNV1A_START;
+	for (i = 0; i < sizeof(strings) / sizeof(strings[0]); ++i)
+	{
+		value = (char const*)glGetString(strings[i]);
+		/* the terminating NUL separates the strings */
+		if (value)
+			cache->driver = fnv1a(cache->driver, value, strlen(value) + 1);
+	}
+	/* binaries are only kept if the driver can give them */
+	if (directory && gl_caps.program_binary)
+	{
+		if (strlen(directory) + 32 >= SHADER_CACHE_PATH)
+		{
+			fprintf(stderr, "error: the shader cache directory path is too long\n");
+			return -1;
+		}
+		if (make_directory(directory))
+			return -1;
+		strcpy(cache->directory, directory);
+	}
+	pthread_mutex_init(&cache->lock, NULL);
+	pthread_cond_init(&cache->queued, NULL);
+	pthread_cond_init(&cache->linked, NULL);
+	if (window && gl_caps.parallel_shader_compile)
+	{
+		cache->compile = SHADER_COMPILE_PARALLEL;
+		/* as many threads as the driver sees fit */
+		if (GLAD_GL_KHR_parallel_shader_compile)
+			glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+		else
+			glMaxShaderCompilerThreadsARB(0xFFFFFFFFu);
+	}
+	else if (window && start_worker(cache, window) == 0)
+		cache->compile = SHADER_COMPILE_THREAD;
+	return 0;
+}
+
+void	shader_cache_free(s_shader_cache* cache)
+{
+	s_shader_program* program;
+	size_t i;
+
+	if (cache->worker_window)
+	{
+		pthread_mutex_lock(&cache->lock);
+		cache->quit = 1;
+		pthread_cond_signal(&cache->queued);
+		pthread_mutex_unlock(&cache->lock);
+		pthread_join(cache->worker, NULL);
+		window_destroy(cache->worker_window);
+		cache->worker_window = NULL;
+	}
+	for (i = 0; i < cache->count; ++i)
+	{
+		program = cache->programs[i];
+		glDeleteProgram(program->program);
+		if (program->shaders[0])
+		{
+			glDeleteShader(program->shaders[0]);
+			glDeleteShader(program->shaders[1]);
+		}
+		free(program->sources[0]);
+		free(program->sources[1]);
+		free(program);
+	}
+	free(cache->programs);
+	cache->programs = NULL;
+	cache->count = 0;
+	cache->capacity = 0;
+	pthread_mutex_destroy(&cache->lock);
+	pthread_cond_destroy(&cache->queued);
+	pthread_cond_destroy(&cache->linked);
+}
+
+//! Starts compiling the shaders of a program, and linking it, without waiting: the driver does it in the background
+static void	compile_parallel(s_shader_cache* cache, s_shader_program* program)
+{
+	GLenum const types[2] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+	int i;
+
+	/* no status is queried until the program is needed: that would wait for it */
+	for (i = 0; i < 2; ++i)
+	{
+		program->shaders[i] = glCreateShader(types[i]);
+		glShaderSource(program->shaders[i], 1, (char const* const*)&program->sources[i], NULL);
+		glCompileShader(program->shaders[i]);
+		glAttachShader(program->program, program->shaders[i]);
+	}
+	if (cache->directory[0])
+		glProgramParameteri(program->program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	glLinkProgram(program->program);
+}
+
+//! Hands a program which the driver compiled in the background over to the renderer (this waits, if it isn't done)
+static void	finish_parallel(s_shader_cache* cache, s_shader_program* program)
+{
+	GLint status = GL_FALSE;
+	int i;
+
+	glGetProgramiv(program->program, GL_LINK_STATUS, &status);
+	if (status != GL_TRUE)
+	{
+		fprintf(stderr, "error: could not compile or link the program:\n");
+		gl_print_log(program->shaders[0], 0);
+		gl_print_log(program->shaders[1], 0);
+		gl_print_log(program->program, 1);
+	}
+	for (i = 0; i < 2; ++i)
+	{
+		glDetachShader(program->program, program->shaders[i]);
+		glDeleteShader(program->shaders[i]);
+		program->shaders[i] = 0;
+	}
+	if (status == GL_TRUE)
+	{
+		++cache->compiled;
+		if (cache->directory[0])
+			save_binary(cache, program->hash, program->program);
+	}
+	atomic_store(&program->status, (status == GL_TRUE ? SHADER_READY : SHADER_FAILED));
+}
+
+//! Hands a program which the worker thread linked over to the renderer
+static void	finish_linked(s_shader_cache* cache, s_shader_program* program)
+{
+	++cache->compiled;
+	free(program->sources[0]);
+	free(program->sources[1]);
+	program->sources[0] = NULL;
+	program->sources[1] = NULL;
+	atomic_store(&program->status, SHADER_READY);
+}
+
+//! Compiles (or starts compiling) a program which was not found, in the way the cache compiles
+static void	compile(s_shader_cache* cache, s_shader_program* program)
+{
+	switch (cache->compile)
+	{
+		case SHADER_COMPILE_PARALLEL:
+			compile_parallel(cache, program);
+			break;
+		case SHADER_COMPILE_THREAD:
+			pthread_mutex_lock(&cache->lock);
+			if (cache->queue)
+				cache->queue_last->next = program;
+			else
+				cache->queue = program;
+			cache->queue_last = program;
+			pthread_cond_signal(&cache->queued);
+			pthread_mutex_unlock(&cache->lock);
+			break;
+		default:
+			if (cache->directory[0])
+				glProgramParameteri(program->program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+			if (gl_link_program(program->program, program->sources[0], program->sources[1]))
+			{
+				atomic_store(&program->status, SHADER_FAILED);
+				break;
+			}
+			++cache->compiled;
+			if (cache->directory[0])
+				save_binary(cache, program->hash, program->program);
+			atomic_store(&program->status, SHADER_READY);
+			break;
+	}
+	/* only the worker thread needs the sources, after this */
+	if (cache->compile != SHADER_COMPILE_THREAD)
+	{
+		free(program->sources[0]);
+		free(program->sources[1]);
+		program->sources[0] = NULL;
+		program->sources[1] = NULL;
+	}
+}
+
+//! Adds a program to the cache, returns `0` on success
+static int	add(s_shader_cache* cache, s_shader_program* program)
+{
+	s_shader_program** programs;
+
+	if (cache->count == cache->capacity)
+	{
+		programs = (s_shader_program**)realloc(cache->programs,
+			(cache->capacity ? cache->capacity * 2 : 16) * sizeof(s_shader_program*));
+		if (!programs)
+			return -1;
+		cache->programs = programs;
+		cache->capacity = (cache->capacity ? cache->capacity * 2 : 16);
+	}
+	cache->programs[cache->count++] = program;
+	return 0;
+}
+
+s_shader_program*	shader_cache_request(s_shader_cache* cache, char const* vertex_source, char const* fragment_source,
+	char const* const* defines)
+{
+	s_shader_program* program;
+	char* sources[2];
+	uint64_t hash = 0;
+	size_t i;
+
+	sources[0] = preprocess(vertex_source, defines);
+	sources[1] = preprocess(fragment_source, defines);
+	program = NULL;
+	if (sources[0] && sources[1])
+	{
+		hash = fnv1a(fnv1a(FNV1A_START, sources[0], strlen(sources[0]) + 1), sources[1], strlen(sources[1]) + 1);
+		for (i = 0; i < cache->count; ++i)
+		{
+			if (cache->programs[i]->hash == hash)
+			{
+				++cache->hits;
+				free(sources[0]);
+				free(sources[1]);
+				return cache->programs[i];
+			}
+		}
+		program = (s_shader_program*)calloc(1, sizeof(s_shader_program));
+	}
+	if (!program || add(cache, program))
+	{
+		free(sources[0]);
+		free(sources[1]);
+		free(program);
+		return NULL;
+	}
+	program->hash = hash;
+	program->program = glCreateProgram();
+	atomic_init(&program->status, SHADER_PENDING);
+	if (cache->directory[0] && load_binary(cache, hash, program->program) == 0)
+	{
+		++cache->loaded;
+		free(sources[0]);
+		free(sources[1]);
+		atomic_store(&program->status, SHADER_READY);
+		return program;
+	}
+	program->sources[0] = sources[0];
+	program->sources[1] = sources[1];
+	compile(cache, program);
+	return program;
+}
+
+GLuint	shader_cache_get(s_shader_cache* cache, s_shader_program* program, GLuint fallback)
+{
+	int status = atomic_load(&program->status);
+	GLint done = GL_FALSE;
+
+	if (status == SHADER_PENDING && cache->compile == SHADER_COMPILE_PARALLEL)
+	{
+		glGetProgramiv(program->program, GL_COMPLETION_STATUS_KHR, &done);
+		if (done)
+			finish_parallel(cache, program);
+	}
+	else if (status == SHADER_LINKED)
+		finish_linked(cache, program);
+	return (atomic_load(&program->status) == SHADER_READY ? program->program : fallback);
+}
+
+GLuint	shader_cache_wait(s_shader_cache* cache, s_shader_program* program)
+{
+	if (atomic_load(&program->status) == SHADER_PENDING)
+	{
+		if (cache->compile == SHADER_COMPILE_PARALLEL)
+			finish_parallel(cache, program);
+		else if (cache->compile == SHADER_COMPILE_THREAD)
+		{
+			pthread_mutex_lock(&cache->lock);
+			while (atomic_load(&program->status) == SHADER_PENDING)
+				pthread_cond_wait(&cache->linked, &cache->lock);
+			pthread_mutex_unlock(&cache->lock);
+		}
+	}
+	return shader_cache_get(cache, program, 0);
+}
+
+GLuint	shader_cache_program(s_shader_cache* cache, char const* vertex_source, char const* fragment_source,
+	char const* const* defines)
+{
+	s_shader_program* program = shader_cache_request(cache, vertex_source, fragment_source, defines);
+
+	return (program ? shader_cache_wait(cache, program) : 0);
+}
+
+void	shader_cache_purge(s_shader_cache const* cache)
+{
+	char path[SHADER_CACHE_PATH];
+	size_t i;
+
+	if (!cache->directory[0])
+		return;
+	for (i = 0; i < cache->count; ++i)
+	{
+		binary_path(cache, cache->programs[i]->hash, path, sizeof(path));
+		remove(path);
+	}
+}
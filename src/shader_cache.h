@@ -0,0 +1,130 @@
+#ifndef SHADER_CACHE_H
+#define SHADER_CACHE_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <pthread.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+
+/*
+**	A cache of linked programs. A program is known by the hash of its
+**	preprocessed sources (with its defines inserted after the `#version`
+**	line): asking twice for the same program gives the same object, and a
+**	program which was linked on an earlier run is loaded back from its
+**	binary (`glGetProgramBinary()`/`glProgramBinary()`), rather than being
+**	compiled again. Binaries are only valid for the driver which made them:
+**	each one is stamped with a hash of the GL vendor, renderer and version
+**	strings, and recompiled (and overwritten) when these changed, or when the
+**	driver refuses it anyway.
+**	Programs can be requested up front, without waiting for them to compile:
+**	with `GL_KHR_parallel_shader_compile` the driver compiles them in the
+**	background, otherwise a worker thread does, with a context of its own
+**	which shares objects with the renderer's (it also draws once with each
+**	program, as some drivers only finish compiling on the first draw).
+**	Whether a program is ready is only asked when it is about to be drawn
+**	with (`shader_cache_get()`), and a fallback program is drawn with until
+**	then.
+*/
+
+//! The longest path of a cache directory
+#define SHADER_CACHE_PATH	512
+
+//! How programs are compiled
+typedef enum shader_compile
+{
+	SHADER_COMPILE_SYNC,		//!< When they are requested, blocking the renderer
+	SHADER_COMPILE_PARALLEL,	//!< By the driver's own threads (`GL_KHR_parallel_shader_compile`)
+	SHADER_COMPILE_THREAD,		//!< On a worker thread, with a shared context
+	ENUMLENGTH_SHADER_COMPILE
+}	e_shader_compile;
+
+//! How far along a program is
+typedef enum shader_status
+{
+	SHADER_PENDING,		//!< Being compiled
+	SHADER_LINKED,		//!< Linked by the worker thread, but not yet handed over to the renderer
+	SHADER_READY,
+	SHADER_FAILED,		//!< It failed to compile or link (the info log was printed to `stderr`)
+	ENUMLENGTH_SHADER_STATUS
+}	e_shader_status;
+
+//! A program in the cache
+typedef struct shader_program
+{
+	uint64_t				hash;		//!< The hash of its preprocessed sources
+	GLuint					program;	//!< Only drawn with once `status` is `SHADER_READY`
+	GLuint					shaders[2];	//!< The vertex and fragment shaders, while the driver compiles them in parallel
+	char*					sources[2];	//!< The preprocessed vertex and fragment sources, until it is linked
+	atomic_int				status;		//!< An `e_shader_status`
+	struct shader_program*	next;		//!< The next program in the worker thread's queue
+}	s_shader_program;
+
+//! The programs which were asked for, and where their binaries are kept
+typedef struct shader_cache
+{
+	char				directory[SHADER_CACHE_PATH];	//!< Where the binaries are written (empty if they aren't)
+	uint64_t			driver;		//!< The hash of the GL vendor, renderer and version strings
+	e_shader_compile	compile;
+	s_shader_program**	programs;
+	size_t				count;
+	size_t				capacity;
+	s_window*			worker_window;	//!< The helper window whose context the worker thread compiles with
+	pthread_t			worker;
+	pthread_mutex_t		lock;		//!< Protects the queue and `quit`
+	pthread_cond_t		queued;		//!< Signaled when a program is queued, or when the worker must quit
+	pthread_cond_t		linked;		//!< Signaled when the worker thread is done with a program
+	s_shader_program*	queue;		//!< The programs which the worker thread has yet to compile, oldest first
+	s_shader_program*	queue_last;
+	int					quit;
+	long				hits;		//!< The amount of programs which were found in memory
+	long				loaded;		//!< The amount of programs which were loaded from their binary
+	long				compiled;	//!< The amount of programs which were compiled and linked
+	long				stale;		//!< The amount of binaries which were found, but made by another driver or refused
+}	s_shader_cache;
+
+//! Sets up an empty cache, returns `0` on success
+/*!
+**	@param cache		The cache to set up (the context of `window` must be current)
+**	@param directory	Where to keep the program binaries (created if needed), or `NULL` to only cache in memory:
+**						binaries are not kept either if the driver can't give them (see `gl_caps.program_binary`)
+**	@param window		The window whose context draws with the programs: a worker thread shares it if the driver
+**						can't compile in parallel by itself (or `NULL` to compile when programs are requested)
+*/
+int		shader_cache_init(s_shader_cache* cache, char const* directory, s_window* window);
+//! Stops the worker thread, and deletes every program of the cache (but not their binaries)
+void	shader_cache_free(s_shader_cache* cache);
+
+//! Asks for the program made of the given sources and defines, without waiting for it to be compiled
+/*!
+**	The program belongs to the cache: it must not be deleted.
+**	@param cache			The cache
+**	@param vertex_source	The GLSL source of the vertex shader, starting with its `#version` line
+**	@param fragment_source	The GLSL source of the fragment shader, starting with its `#version` line
+**	@param defines			The macros to define in both shaders (`"NAME"` or `"NAME value"`), as a `NULL`-terminated array, or `NULL`
+**	@returns
+**	The program, to give to `shader_cache_get()`, or `NULL` if out of memory
+*/
+s_shader_program*	shader_cache_request(s_shader_cache* cache, char const* vertex_source, char const* fragment_source,
+						char const* const* defines);
+//! Returns the program object to draw with: `program`'s if it is ready, `fallback` otherwise (it never waits)
+GLuint	shader_cache_get(s_shader_cache* cache, s_shader_program* program, GLuint fallback);
+//! Waits until a program is ready, and returns its program object (`0` if it failed to compile or link)
+GLuint	shader_cache_wait(s_shader_cache* cache, s_shader_program* program);
+
+//! Gives the program made of the given sources and defines, waiting for it to be compiled if needed
+/*!
+**	@returns
+**	The program, or `0` if it failed to compile or link (the info log is printed to `stderr`)
+*/
+GLuint	shader_cache_program(s_shader_cache* cache, char const* vertex_source, char const* fragment_source,
+			char const* const* defines);
+
+//! Deletes the binaries of the programs in the cache, so that the next run compiles them again
+void	shader_cache_purge(s_shader_cache const* cache);
+
+#endif
@@ -0,0 +1,611 @@
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "softraster.h"
+
+/*
+**	The lanes which pixels are tested and shaded in at once: 8 with AVX2, 4
+**	with SSE2. Without either, pixels are drawn one by one.
+*/
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SOFTRASTER_SIMD
+#define LANES	8
+typedef __m256	t_lanes;
+typedef __m256i	t_int_lanes;
+#define lanes_set1(a)			_mm256_set1_ps(a)
+#define lanes_ramp()			_mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f)
+#define lanes_add(a, b)			_mm256_add_ps(a, b)
+#define lanes_sub(a, b)			_mm256_sub_ps(a, b)
+#define lanes_mul(a, b)			_mm256_mul_ps(a, b)
+#define lanes_min(a, b)			_mm256_min_ps(a, b)
+#define lanes_max(a, b)			_mm256_max_ps(a, b)
+#define lanes_and(a, b)			_mm256_and_ps(a, b)
+#define lanes_select(m, a, b)	_mm256_blendv_ps(b, a, m)
+#define lanes_ge(a, b)			_mm256_cmp_ps(a, b, _CMP_GE_OQ)
+#define lanes_gt(a, b)			_mm256_cmp_ps(a, b, _CMP_GT_OQ)
+#define lanes_lt(a, b)			_mm256_cmp_ps(a, b, _CMP_LT_OQ)
+#define lanes_mask(a)			_mm256_movemask_ps(a)
+#define lanes_load(p)			_mm256_loadu_ps(p)
+#define lanes_store(p, a)		_mm256_storeu_ps(p, a)
+#define lanes_to_int(a)			_mm256_cvttps_epi32(a)
+#define lanes_to_float(a)		_mm256_cvtepi32_ps(a)
+#define lanes_as_int(a)			_mm256_castps_si256(a)
+#define lanes_as_float(a)		_mm256_castsi256_ps(a)
+#define int_lanes_set1(a)		_mm256_set1_epi32(a)
+#define int_lanes_add(a, b)		_mm256_add_epi32(a, b)
+#define int_lanes_and(a, b)		_mm256_and_si256(a, b)
+#define int_lanes_or(a, b)		_mm256_or_si256(a, b)
+#define int_lanes_shl(a, n)		_mm256_slli_epi32(a, n)
+#define int_lanes_shr(a, n)		_mm256_srli_epi32(a, n)
+#define int_lanes_load(p)		_mm256_loadu_si256((__m256i const*)(p))
+#define int_lanes_store(p, a)	_mm256_storeu_si256((__m256i*)(p), a)
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SOFTRASTER_SIMD
+#define LANES	4
+typedef __m128	t_lanes;
+typedef __m128i	t_int_lanes;
+#define lanes_set1(a)			_mm_set1_ps(a)
+#define lanes_ramp()			_mm_setr_ps(0.f, 1.f, 2.f, 3.f)
+#define lanes_add(a, b)			_mm_add_ps(a, b)
+#define lanes_sub(a, b)			_mm_sub_ps(a, b)
+#define lanes_mul(a, b)			_mm_mul_ps(a, b)
+#define lanes_min(a, b)			_mm_min_ps(a, b)
+#define lanes_max(a, b)			_mm_max_ps(a, b)
+#define lanes_and(a, b)			_mm_and_ps(a, b)
+#define lanes_select(m, a, b)	_mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))
+#define lanes_ge(a, b)			_mm_cmpge_ps(a, b)
+#define lanes_gt(a, b)			_mm_cmpgt_ps(a, b)
+#define lanes_lt(a, b)			_mm_cmplt_ps(a, b)
+#define lanes_mask(a)			_mm_movemask_ps(a)
+#define lanes_load(p)			_mm_loadu_ps(p)
+#define lanes_store(p, a)		_mm_storeu_ps(p, a)
+#define lanes_to_int(a)			_mm_cvttps_epi32(a)
+#define lanes_to_float(a)		_mm_cvtepi32_ps(a)
+#define lanes_as_int(a)			_mm_castps_si128(a)
+#define lanes_as_float(a)		_mm_castsi128_ps(a)
+#define int_lanes_set1(a)		_mm_set1_epi32(a)
+#define int_lanes_add(a, b)		_mm_add_epi32(a, b)
+#define int_lanes_and(a, b)		_mm_and_si128(a, b)
+#define int_lanes_or(a, b)		_mm_or_si128(a, b)
+#define int_lanes_shl(a, n)		_mm_slli_epi32(a, n)
+#define int_lanes_shr(a, n)		_mm_srli_epi32(a, n)
+#define int_lanes_load(p)		_mm_loadu_si128((__m128i const*)(p))
+#define int_lanes_store(p, a)	_mm_storeu_si128((__m128i*)(p), a)
+#else
+#define LANES	1
+#endif
+
+static float	plane_at(s_softraster_plane const* plane, float x, float y)
+{
+	return plane->dx * x + plane->dy * y + plane->c;
+}
+
+#ifdef SOFTRASTER_SIMD
+
+//! Returns the value of a plane at each lane
+static t_lanes	plane_lanes(s_softraster_plane const* plane, t_lanes x, t_lanes y)
+{
+	return lanes_add(lanes_add(lanes_mul(lanes_set1(plane->dx), x), lanes_mul(lanes_set1(plane->dy), y)),
+		lanes_set1(plane->c));
+}
+
+//! Returns the integer below each lane (for the values which textures are sampled at)
+static t_int_lanes	floor_lanes(t_lanes value)
+{
+	t_int_lanes i = lanes_to_int(value);
+
+	/* truncation goes up for negative values: the comparison is -1 where it did */
+	return int_lanes_add(i, lanes_as_int(lanes_gt(lanes_to_float(i), value)));
+}
+
+//! Splits RGBA pixels into their channels, from 0 to 255
+static void	unpack_lanes(t_int_lanes pixels, t_lanes channels[4])
+{
+	t_int_lanes const byte = int_lanes_set1(0xFF);
+
+	channels[0] = lanes_to_float(int_lanes_and(pixels, byte));
+	channels[1] = lanes_to_float(int_lanes_and(int_lanes_shr(pixels, 8), byte));
+	channels[2] = lanes_to_float(int_lanes_and(int_lanes_shr(pixels, 16), byte));
+	channels[3] = lanes_to_float(int_lanes_shr(pixels, 24));
+}
+
+//! Rounds a channel (from 0 to 255) to the nearest byte, in the low byte of each lane
+static t_int_lanes	round_lanes(t_lanes channel)
+{
+	return lanes_to_int(lanes_add(lanes_min(lanes_max(channel, lanes_set1(0.f)), lanes_set1(255.f)), lanes_set1(0.5f)));
+}
+
+//! Rounds channels (from 0 to 255) to the nearest bytes, into RGBA pixels
+static t_int_lanes	pack_lanes(t_lanes const channels[4])
+{
+	return int_lanes_or(int_lanes_or(round_lanes(channels[0]), int_lanes_shl(round_lanes(channels[1]), 8)),
+		int_lanes_or(int_lanes_shl(round_lanes(channels[2]), 16), int_lanes_shl(round_lanes(channels[3]), 24)));
+}
+
+//! Samples a texture at each lane
+static t_int_lanes	sample_lanes(s_softraster_texture const* texture, t_lanes u, t_lanes v)
+{
+	int32_t columns[LANES], rows[LANES], texels[LANES];
+	int i;
+
+	int_lanes_store(columns, int_lanes_and(floor_lanes(lanes_mul(u, lanes_set1((float)texture->width))),
+		int_lanes_set1(texture->width - 1)));
+	int_lanes_store(rows, int_lanes_and(floor_lanes(lanes_mul(v, lanes_set1((float)texture->height))),
+		int_lanes_set1(texture->height - 1)));
+	for (i = 0; i < LANES; ++i)
+		texels[i] = (int32_t)texture->texels[rows[i] * texture->width + columns[i]];
+	return int_lanes_load(texels);
+}
+
+//! Shades the lanes of `mask` (which passed the coverage and depth tests), from the pixel at `color` and `depth` on
+static void	shade_lanes(s_softraster_triangle const* triangle, uint32_t* color, float* depth,
+	t_lanes mask, t_lanes z, t_lanes x, t_lanes y)
+{
+	t_lanes source[4], destination[4], texel[4];
+	t_int_lanes pixels = int_lanes_load(color);
+	t_lanes alpha;
+	int i;
+
+	for (i = 0; i < 4; ++i)
+		source[i] = plane_lanes(&triangle->color[i], x, y);
+	if (triangle->texture)
+	{
+		unpack_lanes(sample_lanes(triangle->texture, plane_lanes(&triangle->u, x, y), plane_lanes(&triangle->v, x, y)),
+			texel);
+		for (i = 0; i < 4; ++i)
+			source[i] = lanes_mul(source[i], lanes_mul(texel[i], lanes_set1(1.f / 255.f)));
+	}
+	if (triangle->flags & SOFTRASTER_DEPTH_WRITE)
+		lanes_store(depth, lanes_select(mask, z, lanes_load(depth)));
+	if (triangle->flags & SOFTRASTER_BLEND)
+	{
+		unpack_lanes(pixels, destination);
+		alpha = lanes_min(lanes_max(lanes_mul(source[3], lanes_set1(1.f / 255.f)), lanes_set1(0.f)), lanes_set1(1.f));
+		for (i = 0; i < 4; ++i)
+			source[i] = lanes_add(lanes_mul(source[i], alpha),
+				lanes_mul(destination[i], lanes_sub(lanes_set1(1.f), alpha)));
+	}
+	int_lanes_store(color, lanes_as_int(lanes_select(mask, lanes_as_float(pack_lanes(source)), lanes_as_float(pixels))));
+}
+
+//! Draws the part of a triangle which is within the tile whose top-left pixel is (`tile_x`, `tile_y`)
+static void	draw_triangle(s_softraster* raster, s_softraster_triangle const* triangle, int tile_x, int tile_y)
+{
+	int const left = (triangle->bounds[0] > tile_x ? triangle->bounds[0] : tile_x);
+	int const top = (triangle->bounds[1] > tile_y ? triangle->bounds[1] : tile_y);
+	int const right = (triangle->bounds[2] < tile_x + SOFTRASTER_TILE ? triangle->bounds[2] : tile_x + SOFTRASTER_TILE);
+	int const bottom = (triangle->bounds[3] < tile_y + SOFTRASTER_TILE ? triangle->bounds[3] : tile_y + SOFTRASTER_TILE);
+	t_lanes const ramp = lanes_ramp();
+	t_lanes edges[3], edge_steps[3];
+	t_lanes z, z_step;
+	t_lanes x, y, mask;
+	size_t offset;
+	int column, row, e;
+
+	for (e = 0; e < 3; ++e)
+		edge_steps[e] = lanes_set1(triangle->edges[e].dx * LANES);
+	z_step = lanes_set1(triangle->z.dx * LANES);
+	for (row = top; row < bottom; ++row)
+	{
+		/* the blocks of lanes are aligned within the tile, so that they never go past its edge */
+		column = left & ~(LANES - 1);
+		x = lanes_add(lanes_set1((float)column + 0.5f), ramp);
+		y = lanes_set1((float)row + 0.5f);
+		for (e = 0; e < 3; ++e)
+			edges[e] = plane_lanes(&triangle->edges[e], x, y);
+		z = plane_lanes(&triangle->z, x, y);
+		for (; column < right; column += LANES)
+		{
+			/* only the lanes within the triangle's bounds (so within the framebuffer) count */
+			mask = lanes_and(lanes_ge(x, lanes_set1((float)left)), lanes_lt(x, lanes_set1((float)right)));
+			for (e = 0; e < 3; ++e)
+				mask = lanes_and(mask, triangle->top_left[e] ? lanes_ge(edges[e], lanes_set1(0.f)) :
+					lanes_gt(edges[e], lanes_set1(0.f)));
+			offset = (size_t)row * (size_t)raster->stride + (size_t)column;
+			if (lanes_mask(mask) && (triangle->flags & SOFTRASTER_DEPTH_TEST))
+				mask = lanes_and(mask, lanes_lt(z, lanes_load(raster->depth + offset)));
+			if (lanes_mask(mask))
+				shade_lanes(triangle, raster->color + offset, raster->depth + offset, mask, z, x, y);
+			x = lanes_add(x, lanes_set1((float)LANES));
+			for (e = 0; e < 3; ++e)
+				edges[e] = lanes_add(edges[e], edge_steps[e]);
+			z = lanes_add(z, z_step);
+		}
+	}
+}
+
+#else
+
+//! Rounds a color channel (from 0 to 255) to the nearest byte
+static uint8_t	to_byte(float value)
+{
+	return (uint8_t)(value <= 0.f ? 0 : value >= 255.f ? 255 : (int)(value + 0.5f));
+}
+
+//! Returns the integer below `value` (faster than `floorf()`, for the values which textures are sampled at)
+static int	floor_int(float value)
+{
+	int i = (int)value;
+
+	return (i - ((float)i > value));
+}
+
+//! Shades a pixel which passed the coverage and depth tests
+static void	shade(s_softraster_triangle const* triangle, uint8_t* color, float* depth, float z, float x, float y)
+{
+	s_softraster_texture const* texture = triangle->texture;
+	uint8_t const* texel;
+	float alpha;
+	float c[4];
+	int i;
+
+	for (i = 0; i < 4; ++i)
+		c[i] = plane_at(&triangle->color[i], x, y);
+	if (texture)
+	{
+		texel = (uint8_t const*)&texture->texels[
+			(floor_int(plane_at(&triangle->v, x, y) * (float)texture->height) & (texture->height - 1)) * texture->width +
+			(floor_int(plane_at(&triangle->u, x, y) * (float)texture->width) & (texture->width - 1))];
+		for (i = 0; i < 4; ++i)
+			c[i] *= (float)texel[i] * (1.f / 255.f);
+	}
+	if (triangle->flags & SOFTRASTER_DEPTH_WRITE)
+		*depth = z;
+	if (triangle->flags & SOFTRASTER_BLEND)
+	{
+		alpha = (c[3] <= 0.f ? 0.f : c[3] >= 255.f ? 1.f : c[3] * (1.f / 255.f));
+		for (i = 0; i < 4; ++i)
+			c[i] = c[i] * alpha + (float)color[i] * (1.f - alpha);
+	}
+	for (i = 0; i < 4; ++i)
+		color[i] = to_byte(c[i]);
+}
+
+//! Draws the part of a triangle which is within the tile whose top-left pixel is (`tile_x`, `tile_y`)
+static void	draw_triangle(s_softraster* raster, s_softraster_triangle const* triangle, int tile_x, int tile_y)
+{
+	int const left = (triangle->bounds[0] > tile_x ? triangle->bounds[0] : tile_x);
+	int const top = (triangle->bounds[1] > tile_y ? triangle->bounds[1] : tile_y);
+	int const right = (triangle->bounds[2] < tile_x + SOFTRASTER_TILE ? triangle->bounds[2] : tile_x + SOFTRASTER_TILE);
+	int const bottom = (triangle->bounds[3] < tile_y + SOFTRASTER_TILE ? triangle->bounds[3] : tile_y + SOFTRASTER_TILE);
+	float edge, z, x, y;
+	size_t offset;
+	int column, row, e;
+
+	for (row = top; row < bottom; ++row)
+	{
+		y = (float)row + 0.5f;
+		for (column = left; column < right; ++column)
+		{
+			x = (float)column + 0.5f;
+			for (e = 0; e < 3; ++e)
+			{
+				edge = plane_at(&triangle->edges[e], x, y);
+				if (edge < 0.f || (edge == 0.f && !triangle->top_left[e]))
+					break;
+			}
+			offset = (size_t)row * (size_t)raster->stride + (size_t)column;
+			z = plane_at(&triangle->z, x, y);
+			if (e == 3 && (!(triangle->flags & SOFTRASTER_DEPTH_TEST) || z < raster->depth[offset]))
+				shade(triangle, (uint8_t*)&raster->color[offset], &raster->depth[offset], z, x, y);
+		}
+	}
+}
+
+#endif
+
+//! Clears a tile if asked to, then draws its triangles, in order
+static void	draw_tile(s_softraster* raster, int tile)
+{
+	int const tile_x = (tile % raster->tiles_x) * SOFTRASTER_TILE;
+	int const tile_y = (tile / raster->tiles_x) * SOFTRASTER_TILE;
+	s_softraster_bin const* bin = &raster->bins[tile];
+	size_t offset;
+	size_t i;
+	int x, y;
+
+	if (raster->clear)
+	{
+		for (y = tile_y; y < tile_y + SOFTRASTER_TILE; ++y)
+		{
+			offset = (size_t)y * (size_t)raster->stride + (size_t)tile_x;
+			for (x = 0; x < SOFTRASTER_TILE; ++x)
+			{
+				raster->color[offset + (size_t)x] = raster->clear_color;
+				raster->depth[offset + (size_t)x] = raster->clear_depth;
+			}
+		}
+	}
+	for (i = 0; i < bin->count; ++i)
+		draw_triangle(raster, &raster->triangles[bin->triangles[i]], tile_x, tile_y);
+}
+
+//! Draws the tiles which are left, until there are none
+static void	draw_tiles(s_softraster* raster)
+{
+	int const count = raster->tiles_x * raster->tiles_y;
+	int tile;
+
+	while ((tile = atomic_fetch_add(&raster->next_tile, 1)) < count)
+		draw_tile(raster, tile);
+}
+
+//! Draws tiles on each flush, until the rasterizer is freed
+static void*	worker_run(void* data)
+{
+	s_softraster* raster = (s_softraster*)data;
+	long generation = 0;
+
+	pthread_mutex_lock(&raster->lock);
+	for (;;)
+	{
+		while (raster->generation == generation && !raster->quit)
+			pthread_cond_wait(&raster->start, &raster->lock);
+		if (raster->quit)
+			break;
+		generation = raster->generation;
+		pthread_mutex_unlock(&raster->lock);
+		draw_tiles(raster);
+		pthread_mutex_lock(&raster->lock);
+		if (--raster->busy == 0)
+			pthread_cond_signal(&raster->done);
+	}
+	pthread_mutex_unlock(&raster->lock);
+	return NULL;
+}
+
+int		softraster_init(s_softraster* raster, int width, int height, int threads)
+{
+	size_t pixels;
+
+	memset(raster, 0, sizeof(s_softraster));
+	if (width <= 0 || height <= 0 || threads < 1 || threads > SOFTRASTER_MAX_THREADS)
+	{
+		fprintf(stderr, "error: the software rasterizer needs a nonempty framebuffer, and 1 to %d threads\n",
+			SOFTRASTER_MAX_THREADS);
+		return -1;
+	}
+	raster->width = width;
+	raster->height = height;
+	raster->tiles_x = (width + SOFTRASTER_TILE - 1) / SOFTRASTER_TILE;
+	raster->tiles_y = (height + SOFTRASTER_TILE - 1) / SOFTRASTER_TILE;
+	raster->stride = raster->tiles_x * SOFTRASTER_TILE;
+	/* the framebuffer is a whole amount of tiles, so that tiles never have to check its edges */
+	pixels = (size_t)raster->stride * (size_t)(raster->tiles_y * SOFTRASTER_TILE);
+	raster->color = (uint32_t*)malloc(pixels * sizeof(uint32_t));
+	raster->depth = (float*)malloc(pixels * sizeof(float));
+	raster->bins = (s_softraster_bin*)calloc((size_t)(raster->tiles_x * raster->tiles_y), sizeof(s_softraster_bin));
+	if (!raster->color || !raster->depth || !raster->bins)
+	{
+		fprintf(stderr, "error: could not allocate a %dx%d software framebuffer\n", width, height);
+		softraster_free(raster);
+		return -1;
+	}
+	pthread_mutex_init(&raster->lock, NULL);
+	pthread_cond_init(&raster->start, NULL);
+	pthread_cond_init(&raster->done, NULL);
+	for (raster->worker_count = 0; raster->worker_count < threads - 1; ++raster->worker_count)
+	{
+		if (pthread_create(&raster->workers[raster->worker_count], NULL, worker_run, raster))
+		{
+			fprintf(stderr, "error: could not start the software rasterizer threads\n");
+			softraster_free(raster);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+void	softraster_free(s_softraster* raster)
+{
+	int i;
+
+	if (raster->bins && raster->color && raster->depth)
+	{
+		pthread_mutex_lock(&raster->lock);
+		raster->quit = 1;
+		pthread_cond_broadcast(&raster->start);
+		pthread_mutex_unlock(&raster->lock);
+		for (i = 0; i < raster->worker_count; ++i)
+			pthread_join(raster->workers[i], NULL);
+		pthread_mutex_destroy(&raster->lock);
+		pthread_cond_destroy(&raster->start);
+		pthread_cond_destroy(&raster->done);
+	}
+	if (raster->bins)
+	{
+		for (i = 0; i < raster->tiles_x * raster->tiles_y; ++i)
+			free(raster->bins[i].triangles);
+	}
+	free(raster->bins);
+	free(raster->triangles);
+	free(raster->color);
+	free(raster->depth);
+	memset(raster, 0, sizeof(s_softraster));
+}
+
+//! Empties the bins, and forgets about the triangles
+static void	reset(s_softraster* raster)
+{
+	int i;
+
+	for (i = 0; i < raster->tiles_x * raster->tiles_y; ++i)
+		raster->bins[i].count = 0;
+	raster->triangle_count = 0;
+}
+
+void	softraster_clear(s_softraster* raster, uint8_t const color[4], float depth)
+{
+	/* the triangles which were submitted since the last flush would be cleared anyway */
+	reset(raster);
+	memcpy(&raster->clear_color, color, 4);
+	raster->clear_depth = depth;
+	raster->clear = 1;
+}
+
+//! Sets up the plane which interpolates the given values at the corners of a triangle
+static void	set_plane(s_softraster_plane* plane, s_softraster_vertex const vertices[3], float const values[3])
+{
+	float const x1 = vertices[1].x - vertices[0].x;
+	float const y1 = vertices[1].y - vertices[0].y;
+	float const x2 = vertices[2].x - vertices[0].x;
+	float const y2 = vertices[2].y - vertices[0].y;
+	float const determinant = x1 * y2 - x2 * y1;
+	float const d1 = values[1] - values[0];
+	float const d2 = values[2] - values[0];
+
+	plane->dx = (d1 * y2 - d2 * y1) / determinant;
+	plane->dy = (d2 * x1 - d1 * x2) / determinant;
+	plane->c = values[0] - plane->dx * vertices[0].x - plane->dy * vertices[0].y;
+}
+
+//! Sets up the edge functions of a triangle, returns nonzero if it has an area
+static int	set_edges(s_softraster_triangle* triangle, s_softraster_vertex const vertices[3])
+{
+	s_softraster_plane* edge;
+	float area;
+	int i;
+
+	for (i = 0; i < 3; ++i)
+	{
+		s_softraster_vertex const* a = &vertices[i];
+		s_softraster_vertex const* b = &vertices[(i + 1) % 3];
+		edge = &triangle->edges[i];
+		edge->dx = a->y - b->y;
+		edge->dy = b->x - a->x;
+		edge->c = a->x * b->y - a->y * b->x;
+	}
+	area = plane_at(&triangle->edges[0], vertices[2].x, vertices[2].y);
+	if (!(area > 0.f || area < 0.f))
+		return 0;
+	for (i = 0; i < 3; ++i)
+	{
+		edge = &triangle->edges[i];
+		/* whatever the winding, the edge functions are positive inside */
+		if (area < 0.f)
+		{
+			edge->dx = -edge->dx;
+			edge->dy = -edge->dy;
+			edge->c = -edge->c;
+		}
+		/* with y going down, a left edge has the inside on its right, a top edge below it */
+		triangle->top_left[i] = (edge->dx > 0.f || (edge->dx == 0.f && edge->dy > 0.f));
+	}
+	return 1;
+}
+
+//! Sets the pixels which a triangle may cover, returns nonzero if it is within the framebuffer
+static int	set_bounds(s_softraster_triangle* triangle, s_softraster_vertex const vertices[3], int width, int height)
+{
+	float min_x = vertices[0].x, max_x = vertices[0].x;
+	float min_y = vertices[0].y, max_y = vertices[0].y;
+	int i;
+
+	for (i = 1; i < 3; ++i)
+	{
+		min_x = fminf(min_x, vertices[i].x);
+		max_x = fmaxf(max_x, vertices[i].x);
+		min_y = fminf(min_y, vertices[i].y);
+		max_y = fmaxf(max_y, vertices[i].y);
+	}
+	/* clamped to the target on both sides, as floats, so that huge coordinates (either way) don't overflow */
+	triangle->bounds[0] = (int)floorf(fminf(fmaxf(min_x, 0.f), (float)width));
+	triangle->bounds[1] = (int)floorf(fminf(fmaxf(min_y, 0.f), (float)height));
+	triangle->bounds[2] = (int)ceilf(fminf(fmaxf(max_x, 0.f), (float)width));
+	triangle->bounds[3] = (int)ceilf(fminf(fmaxf(max_y, 0.f), (float)height));
+	return (triangle->bounds[0] < triangle->bounds[2] && triangle->bounds[1] < triangle->bounds[3]);
+}
+
+//! Adds a triangle to the bin of a tile, returns `0` on success
+static int	bin_add(s_softraster_bin* bin, uint32_t triangle)
+{
+	uint32_t* triangles;
+	size_t capacity;
+
+	if (bin->count == bin->capacity)
+	{
+		capacity = (bin->capacity ? bin->capacity * 2 : 64);
+		if (!(triangles = (uint32_t*)realloc(bin->triangles, capacity * sizeof(uint32_t))))
+			return -1;
+		bin->triangles = triangles;
+		bin->capacity = capacity;
+	}
+	bin->triangles[bin->count++] = triangle;
+	return 0;
+}
+
+int		softraster_triangle(s_softraster* raster, s_softraster_vertex const vertices[3],
+	s_softraster_texture const* texture, int flags)
+{
+	s_softraster_triangle* triangle;
+	s_softraster_triangle* triangles;
+	size_t capacity;
+	float values[3];
+	int x, y, i, c;
+
+	if (raster->triangle_count == raster->triangle_capacity)
+	{
+		capacity = (raster->triangle_capacity ? raster->triangle_capacity * 2 : 1024);
+		if (!(triangles = (s_softraster_triangle*)realloc(raster->triangles, capacity * sizeof(s_softraster_triangle))))
+			return -1;
+		raster->triangles = triangles;
+		raster->triangle_capacity = capacity;
+	}
+	triangle = &raster->triangles[raster->triangle_count];
+	/* a triangle which has no area, or is off the framebuffer, draws nothing */
+	if (!set_edges(triangle, vertices) || !set_bounds(triangle, vertices, raster->width, raster->height))
+		return 0;
+	for (i = 0; i < 3; ++i)
+		values[i] = vertices[i].z;
+	set_plane(&triangle->z, vertices, values);
+	for (i = 0; i < 3; ++i)
+		values[i] = vertices[i].u;
+	set_plane(&triangle->u, vertices, values);
+	for (i = 0; i < 3; ++i)
+		values[i] = vertices[i].v;
+	set_plane(&triangle->v, vertices, values);
+	for (c = 0; c < 4; ++c)
+	{
+		for (i = 0; i < 3; ++i)
+			values[i] = (float)vertices[i].color[c];
+		set_plane(&triangle->color[c], vertices, values);
+	}
+	triangle->texture = texture;
+	triangle->flags = flags;
+	for (y = triangle->bounds[1] / SOFTRASTER_TILE; y <= (triangle->bounds[3] - 1) / SOFTRASTER_TILE; ++y)
+	{
+		for (x = triangle->bounds[0] / SOFTRASTER_TILE; x <= (triangle->bounds[2] - 1) / SOFTRASTER_TILE; ++x)
+		{
+			if (bin_add(&raster->bins[y * raster->tiles_x + x], (uint32_t)raster->triangle_count))
+				return -1;
+		}
+	}
+	++raster->triangle_count;
+	return 0;
+}
+
+void	softraster_flush(s_softraster* raster)
+{
+	if (raster->triangle_count == 0 && !raster->clear)
+		return;
+	atomic_store(&raster->next_tile, 0);
+	pthread_mutex_lock(&raster->lock);
+	raster->busy = raster->worker_count;
+	++raster->generation;
+	pthread_cond_broadcast(&raster->start);
+	pthread_mutex_unlock(&raster->lock);
+	/* the thread which flushes draws tiles too */
+	draw_tiles(raster);
+	pthread_mutex_lock(&raster->lock);
+	while (raster->busy > 0)
+		pthread_cond_wait(&raster->done, &raster->lock);
+	pthread_mutex_unlock(&raster->lock);
+	raster->drawn += (long)raster->triangle_count;
+	reset(raster);
+	raster->clear = 0;
+}
@@ -0,0 +1,142 @@
+#ifndef SOFTRASTER_H
+#define SOFTRASTER_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <pthread.h>
+
+/*
+**	A tile-based software rasterizer, for hosts which have no GL driver at
+**	all: it draws textured triangles, with a depth test and alpha blending,
+**	into a framebuffer in system memory. Triangles are set up and binned
+**	into the tiles which their bounds cover as they are submitted; on a
+**	flush, the tiles are shared out between threads (each thread takes the
+**	next tile which is left), and each tile draws its triangles in
+**	submission order. Coverage is tested with edge functions, evaluated for
+**	4 pixels at once with SSE2 (8 with AVX2, if the compiler targets it),
+**	along with the depth test; the covered pixels are then shaded one by one.
+**	It follows GL's conventions where they matter: pixel centers are sampled,
+**	shared edges follow the top-left rule, and the depth test is `GL_LESS`.
+*/
+
+//! The width and height of a tile, in pixels (a multiple of 8)
+#define SOFTRASTER_TILE			64
+//! The most threads which draw the tiles
+#define SOFTRASTER_MAX_THREADS	64
+
+//! The triangle is only drawn where it is closer than the depth buffer
+#define SOFTRASTER_DEPTH_TEST	0x1
+//! The triangle writes its depth where it is drawn
+#define SOFTRASTER_DEPTH_WRITE	0x2
+//! The triangle is blended over the framebuffer with its alpha (like `GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA`)
+#define SOFTRASTER_BLEND		0x4
+
+//! A vertex, as it is submitted
+typedef struct softraster_vertex
+{
+	float	x;			//!< In pixels, from the left of the framebuffer
+	float	y;			//!< In pixels, from the top of the framebuffer
+	float	z;			//!< The depth, from 0 (near) to 1 (far)
+	float	u;			//!< The texture coordinates (1.0 is the width or height of the texture)
+	float	v;
+	uint8_t	color[4];	//!< The RGBA color, which the texture color is multiplied by (255 is 1.0)
+}	s_softraster_vertex;
+
+//! A texture, sampled with nearest filtering, and repeated
+typedef struct softraster_texture
+{
+	uint32_t const*	texels;	//!< The RGBA bytes, first row at the top
+	int				width;	//!< A power of 2
+	int				height;	//!< A power of 2
+}	s_softraster_texture;
+
+//! A plane, which gives a value across a triangle: `x * dx + y * dy + c`
+typedef struct softraster_plane
+{
+	float	dx;
+	float	dy;
+	float	c;
+}	s_softraster_plane;
+
+//! A triangle, once it is set up
+typedef struct softraster_triangle
+{
+	s_softraster_plane			edges[3];	//!< Positive inside the triangle
+	int							top_left[3];//!< Nonzero for the edges which own the pixel centers they go through
+	s_softraster_plane			z;
+	s_softraster_plane			u;
+	s_softraster_plane			v;
+	s_softraster_plane			color[4];	//!< From 0 to 255
+	int							bounds[4];	//!< The pixels which it may cover: left, top, right and bottom (exclusive)
+	s_softraster_texture const*	texture;	//!< `NULL` for no texture
+	int							flags;		//!< `SOFTRASTER_*` flags
+}	s_softraster_triangle;
+
+//! The triangles which cover a tile, in submission order
+typedef struct softraster_bin
+{
+	uint32_t*	triangles;	//!< Indices into the triangles of the rasterizer
+	size_t		count;
+	size_t		capacity;
+}	s_softraster_bin;
+
+//! The framebuffer, the triangles submitted since the last flush, and the threads which draw them
+typedef struct softraster
+{
+	uint32_t*				color;		//!< The RGBA bytes of the framebuffer, first row at the top
+	float*					depth;
+	int						width;		//!< The size of the framebuffer, in pixels
+	int						height;
+	int						stride;		//!< The amount of pixels from a row to the next (a whole amount of tiles)
+	int						tiles_x;	//!< The amount of tiles across the framebuffer
+	int						tiles_y;
+	s_softraster_triangle*	triangles;	//!< The triangles submitted since the last flush
+	size_t					triangle_count;
+	size_t					triangle_capacity;
+	s_softraster_bin*		bins;		//!< The bin of each tile, row by row
+	int						clear;		//!< Nonzero if the tiles are cleared before the triangles are drawn
+	uint32_t				clear_color;
+	float					clear_depth;
+	pthread_t				workers[SOFTRASTER_MAX_THREADS];
+	int						worker_count;	//!< The threads which draw tiles, besides the one which flushes
+	pthread_mutex_t			lock;		//!< Protects `generation`, `busy` and `quit`
+	pthread_cond_t			start;		//!< Signaled when a flush starts, or when the workers must quit
+	pthread_cond_t			done;		//!< Signaled when the last worker is done with a flush
+	long					generation;	//!< The amount of flushes which were started
+	int						busy;		//!< The amount of workers which are still drawing tiles
+	int						quit;
+	atomic_int				next_tile;	//!< The next tile to draw, during a flush
+	long					drawn;		//!< The amount of triangles which were flushed
+}	s_softraster;
+
+//! Allocates the framebuffer, and starts the threads, returns `0` on success
+/*!
+**	@param raster	The rasterizer to set up
+**	@param width	The size of the framebuffer, in pixels
+**	@param height
+**	@param threads	The amount of threads which draw the tiles, counting the one which flushes
+**					(at most `SOFTRASTER_MAX_THREADS`)
+*/
+int		softraster_init(s_softraster* raster, int width, int height, int threads);
+//! Stops the threads, and frees the framebuffer
+void	softraster_free(s_softraster* raster);
+
+//! Clears the framebuffer, before the triangles which are submitted next are drawn
+void	softraster_clear(s_softraster* raster, uint8_t const color[4], float depth);
+//! Sets up a triangle, and bins it into the tiles which it covers, returns `0` on success
+/*!
+**	@param raster	The rasterizer
+**	@param vertices	The corners of the triangle, in either winding order
+**	@param texture	The texture to sample (`NULL` for none): it must stay valid until the next flush
+**	@param flags	`SOFTRASTER_*` flags
+**	@returns
+**	`0` on success, or `-1` if the triangle could not be binned (out of memory)
+*/
+int		softraster_triangle(s_softraster* raster, s_softraster_vertex const vertices[3],
+			s_softraster_texture const* texture, int flags);
+//! Draws the triangles submitted since the last flush (and the clear), and waits for them to be drawn
+void	softraster_flush(s_softraster* raster);
+
+#endif
@@ -0,0 +1,205 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sprites.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "gl_util.h"
+
+char const* const	sprites_vertex_shader =
+	"#version 330 core\n"
+	"layout(location = 0) in vec4 a_rect;\n"
+	"layout(location = 1) in vec4 a_uv;\n"
+	"layout(location = 2) in vec4 a_color;\n"
+	"layout(location = 3) in float a_angle;\n"
+	"uniform vec2 u_viewport;\n"
+	"out vec2 v_uv;\n"
+	"out vec4 v_color;\n"
+	"void main()\n"
+	"{\n"
+	"	vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+	"	vec2 rotation = vec2(cos(a_angle), sin(a_angle));\n"
+	"	vec2 offset = (corner - 0.5) * a_rect.zw;\n"
+	"	vec2 position = a_rect.xy + 0.5 * a_rect.zw + mat2(rotation.x, rotation.y, -rotation.y, rotation.x) * offset;\n"
+	"	gl_Position = vec4(position / u_viewport * vec2(2., -2.) + vec2(-1., 1.), 0., 1.);\n"
+	"	v_uv = mix(a_uv.xy, a_uv.zw, corner);\n"
+	"	v_color = a_color;\n"
+	"}\n";
+
+static char const* const	sprites_fragment_shader =
+	"#version 330 core\n"
+	"uniform sampler2D u_texture;\n"
+	"in vec2 v_uv;\n"
+	"in vec4 v_color;\n"
+	"out vec4 f_color;\n"
+	"void main()\n"
+	"{\n"
+	"	f_color = texture(u_texture, v_uv) * v_color;\n"
+	"}\n";
+
+//! Points the per-instance vertex attributes at the sprites which start at `offset` bytes into the buffer
+static void	set_attributes(size_t offset)
+{
+	glVertexAttribPointer(0, 4, GL_FLOAT,          GL_FALSE, sizeof(s_sprite), (void const*)(offset + offsetof(s_sprite, x)));
+	glVertexAttribPointer(1, 4, GL_UNSIGNED_SHORT, GL_TRUE,  sizeof(s_sprite), (void const*)(offset + offsetof(s_sprite, uv)));
+	glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE,  GL_TRUE,  sizeof(s_sprite), (void const*)(offset + offsetof(s_sprite, color)));
+	glVertexAttribPointer(3, 1, GL_FLOAT,          GL_FALSE, sizeof(s_sprite), (void const*)(offset + offsetof(s_sprite, angle)));
+}
+
+int		sprites_init(s_sprites* sprites, size_t batch)
+{
+	int i;
+
+	memset(sprites, 0, sizeof(s_sprites));
+	sprites->batch = (batch ? batch : SPRITES_DEFAULT_BATCH);
+	sprites->queue = (s_sprite*)malloc(sprites->batch * sizeof(s_sprite));
+	sprites->keys = (uint8_t*)malloc(sprites->batch);
+	if (!sprites->queue || !sprites->keys ||
+		!(sprites->program = gl_create_program(sprites_vertex_shader, sprites_fragment_shader)) ||
+		gpu_ring_init(&sprites->ring, GPU_RING_FRAMES * sprites->batch * sizeof(s_sprite)))
+	{
+		sprites_free(sprites);
+		return -1;
+	}
+	sprites->viewport_location = glGetUniformLocation(sprites->program, "u_viewport");
+	/* the 4 corners come from gl_VertexID, so all of the vertex data is per-instance */
+	glGenVertexArrays(1, &sprites->vertex_array);
+	gl_state_bind_vertex_array(sprites->vertex_array);
+	gl_state_bind_buffer(GL_ARRAY_BUFFER, sprites->ring.buffer);
+	for (i = 0; i < 4; ++i)
+	{
+		glEnableVertexAttribArray((GLuint)i);
+		glVertexAttribDivisor((GLuint)i, 1);
+	}
+	set_attributes(0);
+	return 0;
+}
+
+void	sprites_free(s_sprites* sprites)
+{
+	if (sprites->program)
+		glDeleteProgram(sprites->program);
+	gpu_ring_free(&sprites->ring);
+	if (sprites->vertex_array)
+		gl_state_delete_vertex_arrays(1, &sprites->vertex_array);
+	free(sprites->queue);
+	free(sprites->keys);
+	memset(sprites, 0, sizeof(s_sprites));
+}
+
+void	sprites_begin(s_sprites* sprites, int width, int height)
+{
+	sprites->viewport[0] = (float)width;
+	sprites->viewport[1] = (float)height;
+	sprites->count = 0;
+	sprites->state_count = 0;
+	sprites->last_state = 0;
+	sprites->draw_calls = 0;
+	sprites->drawn = 0;
+}
+
+//! Returns the index of the given state among the queued ones, adding it if needed
+static int	find_state(s_sprites* sprites, GLuint program, GLuint texture)
+{
+	s_sprite_state* state;
+	GLint location = -1;
+	int i;
+
+	for (i = 0; i < sprites->state_count; ++i)
+	{
+		if (sprites->states[i].program == program && sprites->states[i].texture == texture)
+			return i;
+	}
+	if (sprites->state_count == SPRITES_MAX_STATES)
+		sprites_flush(sprites);
+	/* the uniform's location is looked up once per program, here, rather than on each program switch */
+	if (program == sprites->program)
+		location = sprites->viewport_location;
+	for (i = 0; location == -1 && i < sprites->state_count; ++i)
+	{
+		if (sprites->states[i].program == program)
+			location = sprites->states[i].viewport_location;
+	}
+	if (location == -1)
+		location = glGetUniformLocation(program, "u_viewport");
+	state = &sprites->states[sprites->state_count];
+	state->program = program;
+	state->texture = texture;
+	state->viewport_location = location;
+	return sprites->state_count++;
+}
+
+s_sprite*	sprites_add(s_sprites* sprites, GLuint program, GLuint texture)
+{
+	s_sprite_state const* state = &sprites->states[sprites->last_state];
+	int key = sprites->last_state;
+
+	if (program == 0)
+		program = sprites->program;
+	if (key >= sprites->state_count || state->program != program || state->texture != texture)
+		key = find_state(sprites, program, texture);
+	if (sprites->count == sprites->batch)
+	{
+		sprites_flush(sprites);
+		key = find_state(sprites, program, texture);
+	}
+	sprites->last_state = key;
+	sprites->keys[sprites->count] = (uint8_t)key;
+	return &sprites->queue[sprites->count++];
+}
+
+
+void	sprites_flush(s_sprites* sprites)
+{
+	size_t first[SPRITES_MAX_STATES + 1];
+	GLuint program = 0;
+	int state;
+
+	if (sprites->count == 0)
+		return;
+	if (gpu_ring_write_sorted(&sprites->ring, sprites->queue, sprites->keys, sprites->count, sizeof(s_sprite),
+		sprites->state_count, first))
+		fprintf(stderr, "error: could not map the sprite vertex buffer\n");
+	else
+	{
+		gl_state_bind_vertex_array(sprites->vertex_array);
+		gl_state_bind_buffer(GL_ARRAY_BUFFER, sprites->ring.buffer);
+		gl_state_enable(GL_BLEND, 1);
+		gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		for (state = 0; state < sprites->state_count; ++state)
+		{
+			if (first[state + 1] == first[state])
+				continue;
+			if (sprites->states[state].program != program)
+			{
+				program = sprites->states[state].program;
+				gl_state_use_program(program);
+				glUniform2fv(sprites->states[state].viewport_location, 1, sprites->viewport);
+			}
+			gl_state_bind_texture(0, GL_TEXTURE_2D, sprites->states[state].texture);
+			if (gl_caps.base_instance)
+				glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, 4,
+					(GLsizei)(first[state + 1] - first[state]), (GLuint)first[state]);
+			else
+			{
+				/* without a base instance, the attributes are moved to the start of the group instead */
+				set_attributes(first[state] * sizeof(s_sprite));
+				glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)(first[state + 1] - first[state]));
+			}
+			++sprites->draw_calls;
+		}
+		/* a batch can take up a whole frame's share of the ring: it may be reused as soon as it is drawn */
+		gpu_ring_fence(&sprites->ring);
+		sprites->drawn += (long)sprites->count;
+	}
+	sprites->count = 0;
+	sprites->state_count = 0;
+	sprites->last_state = 0;
+}
+
+void	sprites_end(s_sprites* sprites)
+{
+	sprites_flush(sprites);
+}
@@ -0,0 +1,96 @@
+#ifndef SPRITES_H
+#define SPRITES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <glad/glad.h>
+
+#include "gpu_ring.h"
+
+/*
+**	A batch renderer for textured 2D quads: sprites are queued up between
+**	`sprites_begin()` and `sprites_end()`, then grouped by program and
+**	texture (a stable counting sort, straight into a ring buffer which stays
+**	mapped), and drawn with one instanced draw call per group.
+**	Within a group the submission order is kept, but not across groups:
+**	overlapping sprites which use different textures may be drawn in any order.
+*/
+
+//! The most (program, texture) pairs in one batch: past this, the batch is flushed early
+#define SPRITES_MAX_STATES	256
+
+//! The default amount of sprites in one batch: past this, the batch is flushed early
+#define SPRITES_DEFAULT_BATCH	65536
+
+//! One textured quad, as stored in the vertex buffer (one instance per quad)
+typedef struct sprite
+{
+	float		x;			//!< The left edge, in pixels from the left of the viewport
+	float		y;			//!< The top edge, in pixels from the top of the viewport
+	float		width;		//!< In pixels
+	float		height;		//!< In pixels
+	float		angle;		//!< The clockwise rotation around the center, in radians
+	uint16_t	uv[4];		//!< The texture coordinates of the top-left and bottom-right corners (65535 is 1.0)
+	uint8_t		color[4];	//!< The RGBA tint, which the texture color is multiplied by (255 is 1.0)
+}	s_sprite;
+
+//! The program and texture which a group of sprites is drawn with
+typedef struct sprite_state
+{
+	GLuint	program;
+	GLuint	texture;
+	GLint	viewport_location;	//!< The location of `u_viewport` in `program`
+}	s_sprite_state;
+
+//! The sprite batch renderer, and the sprites queued up since `sprites_begin()`
+typedef struct sprites
+{
+	GLuint			vertex_array;
+	s_gpu_ring		ring;			//!< The streaming vertex buffer, which holds the sorted sprites of the last few batches
+	GLuint			program;		//!< The default program (texture times tint color)
+	GLint			viewport_location;	//!< The location of `u_viewport` in the default program
+	s_sprite*		queue;			//!< The sprites queued up since the last flush, in submission order
+	uint8_t*		keys;			//!< The index in `states` of each queued sprite
+	size_t			count;			//!< The amount of queued sprites
+	size_t			batch;			//!< The amount of sprites which `queue` and `keys` can hold
+	s_sprite_state	states[SPRITES_MAX_STATES];	//!< The distinct (program, texture) pairs which are queued
+	int				state_count;
+	int				last_state;		//!< The state of the last queued sprite: usually the same as the next one
+	float			viewport[2];	//!< The size of the viewport, in pixels
+	long			draw_calls;		//!< The amount of draw calls since `sprites_begin()`
+	long			drawn;			//!< The amount of sprites drawn since `sprites_begin()`
+}	s_sprites;
+
+//! Creates the vertex buffer and default program, returns `0` on success
+/*!
+**	@param sprites	The sprite batch renderer to set up
+**	@param batch	The most sprites to sort and draw at once (`0` for `SPRITES_DEFAULT_BATCH`):
+**					the vertex buffer holds `GPU_RING_FRAMES` batches
+*/
+int		sprites_init(s_sprites* sprites, size_t batch);
+//! Deletes the GL objects and the queue
+void	sprites_free(s_sprites* sprites);
+
+//! Starts a new batch, for a viewport of the given size (in pixels)
+void	sprites_begin(s_sprites* sprites, int width, int height);
+
+//! Queues up a sprite, and returns it so that the caller fills it in
+/*!
+**	@param sprites	The sprite batch renderer
+**	@param program	The program to draw this sprite with (`0` for the default program)
+**	@param texture	The 2D texture to sample from
+**	@returns
+**	The sprite to fill in (the batch is flushed first, if it is full)
+*/
+s_sprite*	sprites_add(s_sprites* sprites, GLuint program, GLuint texture);
+
+//! Draws all of the queued sprites
+void	sprites_flush(s_sprites* sprites);
+//! Draws all of the queued sprites, and ends the batch
+void	sprites_end(s_sprites* sprites);
+
+//! The GLSL source of the default vertex shader, which custom sprite programs may be linked with
+extern char const* const	sprites_vertex_shader;
+
+#endif
@@ -0,0 +1,550 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "texture_file.h"
+
+//! Not in every GL header: BC1-BC3 come from an extension which was never made core
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT	0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT	0x83F3
+#endif
+
+static s_texture_format_info const	formats[ENUMLENGTH_TEXTURE_FORMAT] =
+{
+	{ "rgba8", GL_RGBA8,                          1, 4 },
+	{ "bc1",   GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,  4, 8 },
+	{ "bc3",   GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,  4, 16 },
+	{ "bc7",   GL_COMPRESSED_RGBA_BPTC_UNORM,     4, 16 },
+	{ "etc2",  GL_COMPRESSED_RGBA8_ETC2_EAC,      4, 16 },
+};
+
+s_texture_format_info const*	texture_format_info(e_texture_format format)
+{
+	return &formats[format];
+}
+
+int		texture_format_find(char const* name)
+{
+	int i;
+
+	for (i = 0; i < ENUMLENGTH_TEXTURE_FORMAT; ++i)
+	{
+		if (strcmp(formats[i].name, name) == 0)
+			return i;
+	}
+	return -1;
+}
+
+size_t	texture_format_level_size(e_texture_format format, int width, int height)
+{
+	s_texture_format_info const* info = &formats[format];
+	size_t columns = (size_t)(width + info->block_size - 1) / (size_t)info->block_size;
+	size_t rows = (size_t)(height + info->block_size - 1) / (size_t)info->block_size;
+
+	return columns * rows * (size_t)info->block_bytes;
+}
+
+//! Returns the size of the given level of a mip chain, whose first level is `size` texels wide (or high)
+static int	level_extent(uint32_t size, int level)
+{
+	size >>= level;
+	return (size ? (int)size : 1);
+}
+
+//! Checks that a mapped file is a texture file which this version can load, returns `0` if it is
+static int	validate(s_texture_file const* file, char const* path)
+{
+	s_texture_file_header const* header = file->header;
+	uint32_t i;
+
+	if (file->size < sizeof(s_texture_file_header) || memcmp(header->magic, TEXTURE_FILE_MAGIC, 4) != 0)
+	{
+		fprintf(stderr, "error: '%s' is not a texture file\n", path);
+		return -1;
+	}
+	if (header->version != TEXTURE_FILE_VERSION || header->format >= ENUMLENGTH_TEXTURE_FORMAT ||
+		header->width == 0 || header->height == 0 ||
+		header->level_count == 0 || header->level_count > TEXTURE_FILE_MAX_LEVELS)
+	{
+		fprintf(stderr, "error: '%s' has an unsupported version, format or size\n", path);
+		return -1;
+	}
+	for (i = 0; i < header->level_count; ++i)
+	{
+		if (header->levels[i].offset > file->size ||
+			header->levels[i].size > file->size - header->levels[i].offset ||
+			header->levels[i].size != texture_format_level_size((e_texture_format)header->format,
+				level_extent(header->width, (int)i), level_extent(header->height, (int)i)))
+		{
+			fprintf(stderr, "error: '%s' is truncated, or its level %u is corrupt\n", path, i);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+int		texture_file_map(s_texture_file* file, char const* path)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER size;
+
+	memset(file, 0, sizeof(s_texture_file));
+	file->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file->file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file->file, &size) ||
+		!(file->mapping = CreateFileMappingA(file->file, NULL, PAGE_READONLY, 0, 0, NULL)) ||
+		!(file->header = (s_texture_file_header const*)MapViewOfFile(file->mapping, FILE_MAP_READ, 0, 0, 0)))
+	{
+		fprintf(stderr, "error: could not map '%s'\n", path);
+		if (file->mapping)
+			CloseHandle(file->mapping);
+		if (file->file != INVALID_HANDLE_VALUE)
+			CloseHandle(file->file);
+		return -1;
+	}
+	file->size = (size_t)size.QuadPart;
+#else
+	struct stat status;
+	void* mapping;
+	int descriptor;
+
+	memset(file, 0, sizeof(s_texture_file));
+	descriptor = open(path, O_RDONLY);
+	if (descriptor < 0 || fstat(descriptor, &status) != 0 || status.st_size == 0 ||
+		(mapping = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0)) == MAP_FAILED)
+	{
+		fprintf(stderr, "error: could not map '%s'\n", path);
+		if (descriptor >= 0)
+			close(descriptor);
+		return -1;
+	}
+	/* the mapping outlives the descriptor */
+	close(descriptor);
+	file->header = (s_texture_file_header const*)mapping;
+	file->size = (size_t)status.st_size;
+#endif
+	if (validate(file, path))
+	{
+		texture_file_unmap(file);
+		return -1;
+	}
+	return 0;
+}
+
+void	texture_file_unmap(s_texture_file* file)
+{
+	if (!file->header)
+		return;
+#if defined(_WIN32)
+	UnmapViewOfFile((void const*)file->header);
+	CloseHandle(file->mapping);
+	CloseHandle(file->file);
+#else
+	munmap((void*)file->header, file->size);
+#endif
+	file->header = NULL;
+	file->size = 0;
+}
+
+void const*	texture_file_level(s_texture_file const* file, int level)
+{
+	return (uint8_t const*)file->header + file->header->levels[level].offset;
+}
+
+/*
+**	Encoding, for the converter: each level is box filtered from the one
+**	before it, and the block compressed formats are encoded with a fit of
+**	the bounding box of each block, which is fast but not the best quality.
+*/
+
+//! Reads a texel, with the coordinates clamped to the image (partial blocks repeat their edge)
+static uint8_t const*	texel(uint8_t const* pixels, int width, int height, int x, int y)
+{
+	x = (x < width ? x : width - 1);
+	y = (y < height ? y : height - 1);
+	return pixels + ((size_t)y * (size_t)width + (size_t)x) * 4;
+}
+
+//! Gives the next level of a mip chain, each texel the average of (up to) 4 texels of `pixels`
+static uint8_t*	downsample(uint8_t const* pixels, int width, int height, int* next_width, int* next_height)
+{
+	uint8_t* result;
+	int x, y, c;
+
+	*next_width = (width > 1 ? width / 2 : 1);
+	*next_height = (height > 1 ? height / 2 : 1);
+	if (!(result = (uint8_t*)malloc((size_t)*next_width * (size_t)*next_height * 4)))
+		return NULL;
+	for (y = 0; y < *next_height; ++y)
+	{
+		for (x = 0; x < *next_width; ++x)
+		{
+			for (c = 0; c < 4; ++c)
+			{
+				result[((size_t)y * (size_t)*next_width + (size_t)x) * 4 + (size_t)c] = (uint8_t)((
+					texel(pixels, width, height, x * 2, y * 2)[c] +
+					texel(pixels, width, height, x * 2 + 1, y * 2)[c] +
+					texel(pixels, width, height, x * 2, y * 2 + 1)[c] +
+					texel(pixels, width, height, x * 2 + 1, y * 2 + 1)[c] + 2) / 4);
+			}
+		}
+	}
+	return result;
+}
+
+//! Returns the squared distance between two colors, over the first `channels` channels
+static int	distance(uint8_t const* a, uint8_t const* b, int channels)
+{
+	int total = 0;
+	int c;
+
+	for (c = 0; c < channels; ++c)
+		total += (a[c] - b[c]) * (a[c] - b[c]);
+	return total;
+}
+
+//! Returns the index of the color of `palette` which is nearest to `color`
+static int	nearest(uint8_t const* color, uint8_t const (*palette)[4], int count, int channels)
+{
+	int best = 0;
+	int best_distance = distance(color, palette[0], channels);
+	int i, d;
+
+	for (i = 1; i < count; ++i)
+	{
+		if ((d = distance(color, palette[i], channels)) < best_distance)
+		{
+			best = i;
+			best_distance = d;
+		}
+	}
+	return best;
+}
+
+//! Gets the bounding box of the colors of a block, inset by 1/16 of its size on each side (to lower the error)
+static void	bounding_box(uint8_t const block[16][4], uint8_t low[4], uint8_t high[4])
+{
+	int i, c, inset;
+
+	memcpy(low, block[0], 4);
+	memcpy(high, block[0], 4);
+	for (i = 1; i < 16; ++i)
+	{
+		for (c = 0; c < 4; ++c)
+		{
+			low[c] = (block[i][c] < low[c] ? block[i][c] : low[c]);
+			high[c] = (block[i][c] > high[c] ? block[i][c] : high[c]);
+		}
+	}
+	for (c = 0; c < 4; ++c)
+	{
+		inset = (high[c] - low[c]) / 16;
+		low[c] = (uint8_t)(low[c] + inset);
+		high[c] = (uint8_t)(high[c] - inset);
+	}
+}
+
+//! Quantizes a color to RGB 5:6:5
+static uint16_t	to_565(uint8_t const* color)
+{
+	return (uint16_t)(((color[0] * 31 + 127) / 255) << 11 | ((color[1] * 63 + 127) / 255) << 5 |
+		((color[2] * 31 + 127) / 255));
+}
+
+//! Expands an RGB 5:6:5 color back to bytes
+static void	from_565(uint16_t value, uint8_t* color)
+{
+	color[0] = (uint8_t)(((value >> 11) & 31) * 255 / 31);
+	color[1] = (uint8_t)(((value >> 5) & 63) * 255 / 63);
+	color[2] = (uint8_t)((value & 31) * 255 / 31);
+	color[3] = 255;
+}
+
+//! Encodes the colors of a block in BC1, in its 4-color mode (which BC3 always uses)
+static void	encode_bc1(uint8_t const block[16][4], uint8_t* out)
+{
+	uint8_t palette[4][4];
+	uint8_t low[4], high[4];
+	uint16_t endpoints[2];
+	uint32_t indices = 0;
+	int i, c;
+
+	bounding_box(block, low, high);
+	endpoints[0] = to_565(high);
+	endpoints[1] = to_565(low);
+	/* the 4-color mode is the one where the first endpoint is the greatest: with equal ones, every index is 0 */
+	if (endpoints[0] < endpoints[1])
+	{
+		endpoints[0] ^= endpoints[1];
+		endpoints[1] ^= endpoints[0];
+		endpoints[0] ^= endpoints[1];
+	}
+	from_565(endpoints[0], palette[0]);
+	from_565(endpoints[1], palette[1]);
+	for (c = 0; c < 4; ++c)
+	{
+		palette[2][c] = (uint8_t)((2 * palette[0][c] + palette[1][c]) / 3);
+		palette[3][c] = (uint8_t)((palette[0][c] + 2 * palette[1][c]) / 3);
+	}
+	for (i = 0; i < 16 && endpoints[0] != endpoints[1]; ++i)
+		indices |= (uint32_t)nearest(block[i], (uint8_t const (*)[4])palette, 4, 3) << (i * 2);
+	out[0] = (uint8_t)endpoints[0];
+	out[1] = (uint8_t)(endpoints[0] >> 8);
+	out[2] = (uint8_t)endpoints[1];
+	out[3] = (uint8_t)(endpoints[1] >> 8);
+	for (i = 0; i < 4; ++i)
+		out[4 + i] = (uint8_t)(indices >> (i * 8));
+}
+
+//! Encodes the alphas of a block in BC3, in its 8-alpha mode
+static void	encode_bc3_alpha(uint8_t const block[16][4], uint8_t* out)
+{
+	int alphas[8];
+	uint64_t indices = 0;
+	int low = 255, high = 0;
+	int best, best_distance;
+	int i, j;
+
+	for (i = 0; i < 16; ++i)
+	{
+		low = (block[i][3] < low ? block[i][3] : low);
+		high = (block[i][3] > high ? block[i][3] : high);
+	}
+	alphas[0] = high;
+	alphas[1] = low;
+	for (i = 1; i < 7; ++i)
+		alphas[i + 1] = ((7 - i) * high + i * low) / 7;
+	for (i = 0; i < 16 && high != low; ++i)
+	{
+		best = 0;
+		best_distance = 256;
+		for (j = 0; j < 8; ++j)
+		{
+			if (abs(block[i][3] - alphas[j]) < best_distance)
+			{
+				best = j;
+				best_distance = abs(block[i][3] - alphas[j]);
+			}
+		}
+		indices |= (uint64_t)best << (i * 3);
+	}
+	out[0] = (uint8_t)high;
+	out[1] = (uint8_t)low;
+	for (i = 0; i < 6; ++i)
+		out[2 + i] = (uint8_t)(indices >> (i * 8));
+}
+
+//! Appends `count` bits of `value` to a block, least significant first
+static void	put_bits(uint8_t* out, int* position, uint32_t value, int count)
+{
+	int i;
+
+	for (i = 0; i < count; ++i, ++*position)
+	{
+		if (value & (1u << i))
+			out[*position / 8] |= (uint8_t)(1u << (*position % 8));
+	}
+}
+
+//! Quantizes an endpoint to the 7 bits per channel and shared bit of BC7's mode 6, picking the better shared bit
+static void	quantize_bc7(uint8_t const* color, uint8_t* quantized, int* shared)
+{
+	int best_error = -1;
+	int error, value;
+	int bit, c;
+
+	for (bit = 0; bit < 2; ++bit)
+	{
+		error = 0;
+		for (c = 0; c < 4; ++c)
+		{
+			value = (color[c] - bit + 1) >> 1;
+			value = (value < 0 ? 0 : value > 127 ? 127 : value);
+			error += abs(((value << 1) | bit) - color[c]);
+		}
+		if (best_error < 0 || error < best_error)
+		{
+			best_error = error;
+			*shared = bit;
+			for (c = 0; c < 4; ++c)
+			{
+				value = (color[c] - bit + 1) >> 1;
+				quantized[c] = (uint8_t)(value < 0 ? 0 : value > 127 ? 127 : value);
+			}
+		}
+	}
+}
+
+//! Encodes a block in BC7, in mode 6 (one subset, RGBA endpoints, 4-bit indices)
+static void	encode_bc7(uint8_t const block[16][4], uint8_t* out)
+{
+	static int const	weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+	uint8_t endpoints[2][4];
+	uint8_t quantized[2][4];
+	uint8_t palette[16][4];
+	int indices[16];
+	int shared[2];
+	int position = 0;
+	int i, c, e;
+
+	bounding_box(block, endpoints[0], endpoints[1]);
+	for (e = 0; e < 2; ++e)
+	{
+		quantize_bc7(endpoints[e], quantized[e], &shared[e]);
+		for (c = 0; c < 4; ++c)
+			endpoints[e][c] = (uint8_t)((quantized[e][c] << 1) | shared[e]);
+	}
+	for (i = 0; i < 16; ++i)
+	{
+		for (c = 0; c < 4; ++c)
+			palette[i][c] = (uint8_t)(((64 - weights[i]) * endpoints[0][c] + weights[i] * endpoints[1][c] + 32) >> 6);
+	}
+	for (i = 0; i < 16; ++i)
+		indices[i] = nearest(block[i], (uint8_t const (*)[4])palette, 16, 4);
+	/* the first index has no top bit: it must be below 8, which swapping the endpoints ensures */
+	if (indices[0] >= 8)
+	{
+		for (c = 0; c < 4; ++c)
+		{
+			e = quantized[0][c];
+			quantized[0][c] = quantized[1][c];
+			quantized[1][c] = (uint8_t)e;
+		}
+		e = shared[0];
+		shared[0] = shared[1];
+		shared[1] = e;
+		for (i = 0; i < 16; ++i)
+			indices[i] = 15 - indices[i];
+	}
+	memset(out, 0, 16);
+	put_bits(out, &position, 1u << 6, 7);
+	for (c = 0; c < 4; ++c)
+	{
+		put_bits(out, &position, quantized[0][c], 7);
+		put_bits(out, &position, quantized[1][c], 7);
+	}
+	put_bits(out, &position, (uint32_t)shared[0], 1);
+	put_bits(out, &position, (uint32_t)shared[1], 1);
+	for (i = 0; i < 16; ++i)
+		put_bits(out, &position, (uint32_t)indices[i], (i == 0 ? 3 : 4));
+}
+
+//! Encodes a level in the given format (which has an encoder)
+static void	encode_level(e_texture_format format, uint8_t const* pixels, int width, int height, uint8_t* out)
+{
+	uint8_t block[16][4];
+	int x, y, i;
+
+	if (format == TEXTURE_FORMAT_RGBA8)
+	{
+		memcpy(out, pixels, (size_t)width * (size_t)height * 4);
+		return;
+	}
+	for (y = 0; y < height; y += 4)
+	{
+		for (x = 0; x < width; x += 4)
+		{
+			for (i = 0; i < 16; ++i)
+				memcpy(block[i], texel(pixels, width, height, x + i % 4, y + i / 4), 4);
+			if (format == TEXTURE_FORMAT_BC1)
+				encode_bc1((uint8_t const (*)[4])block, out);
+			else if (format == TEXTURE_FORMAT_BC3)
+			{
+				encode_bc3_alpha((uint8_t const (*)[4])block, out);
+				encode_bc1((uint8_t const (*)[4])block, out + 8);
+			}
+			else
+				encode_bc7((uint8_t const (*)[4])block, out);
+			out += formats[format].block_bytes;
+		}
+	}
+}
+
+int		texture_file_write(char const* path, e_texture_format format, uint8_t const* pixels, int width, int height,
+	int mipmaps)
+{
+	static uint8_t const	padding[TEXTURE_FILE_ALIGNMENT];
+	s_texture_file_header header;
+	uint8_t const* levels[TEXTURE_FILE_MAX_LEVELS] = { NULL };
+	uint8_t* encoded = NULL;
+	uint64_t offset = sizeof(s_texture_file_header);
+	int level_width = width;
+	int level_height = height;
+	int status = 0;
+	size_t size, gap;
+	FILE* file;
+	uint32_t i;
+
+	if (format == TEXTURE_FORMAT_ETC2)
+	{
+		fprintf(stderr, "error: there is no encoder for the %s format\n", formats[format].name);
+		return -1;
+	}
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, TEXTURE_FILE_MAGIC, 4);
+	header.version = TEXTURE_FILE_VERSION;
+	header.format = (uint32_t)format;
+	header.width = (uint32_t)width;
+	header.height = (uint32_t)height;
+	/* each level is built from the one before it: the first one is the image itself */
+	levels[0] = pixels;
+	header.level_count = 1;
+	while (mipmaps && (level_width > 1 || level_height > 1) && header.level_count < TEXTURE_FILE_MAX_LEVELS)
+	{
+		levels[header.level_count] = downsample(levels[header.level_count - 1], level_width, level_height,
+			&level_width, &level_height);
+		if (!levels[header.level_count])
+			break;
+		++header.level_count;
+	}
+	for (i = 0; i < header.level_count; ++i)
+	{
+		header.levels[i].offset = offset;
+		header.levels[i].size = texture_format_level_size(format,
+			level_extent(header.width, (int)i), level_extent(header.height, (int)i));
+		offset = (offset + header.levels[i].size + TEXTURE_FILE_ALIGNMENT - 1) / TEXTURE_FILE_ALIGNMENT *
+			TEXTURE_FILE_ALIGNMENT;
+	}
+	file = fopen(path, "wb");
+	if (!file || fwrite(&header, sizeof(header), 1, file) != 1)
+		status = -1;
+	for (i = 0; i < header.level_count && status == 0; ++i)
+	{
+		size = (size_t)header.levels[i].size;
+		/* up to the start of the next level */
+		gap = (TEXTURE_FILE_ALIGNMENT - size % TEXTURE_FILE_ALIGNMENT) % TEXTURE_FILE_ALIGNMENT;
+		free(encoded);
+		if (!(encoded = (uint8_t*)malloc(size)))
+		{
+			status = -1;
+			break;
+		}
+		encode_level(format, levels[i], level_extent(header.width, (int)i), level_extent(header.height, (int)i),
+			encoded);
+		if (fwrite(encoded, 1, size, file) != size || fwrite(padding, 1, gap, file) != gap)
+			status = -1;
+	}
+	if (file && fclose(file) != 0)
+		status = -1;
+	if (status)
+	{
+		fprintf(stderr, "error: could not write '%s'\n", path);
+		if (file)
+			remove(path);
+	}
+	free(encoded);
+	for (i = 1; i < header.level_count; ++i)
+		free((void*)levels[i]);
+	return status;
+}
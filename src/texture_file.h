@@ -0,0 +1,114 @@
+#ifndef TEXTURE_FILE_H
+#define TEXTURE_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <glad/glad.h>
+
+/*
+**	A texture container whose payloads are ready to be handed to GL as they
+**	are: a fixed header, then each level of the mip chain, already in the
+**	layout which `glTexSubImage2D()`/`glCompressedTexSubImage2D()` read
+**	(RGBA bytes, or compressed blocks, rows in GL's order: the first one is
+**	at `t = 0`). Loading one maps the file into memory and points GL at the
+**	mapping: there is nothing to decode, and no copy but the driver's.
+**	Files are written offline, by the `texconv` tool (see `make tools`).
+**
+**	The layout, in little-endian:
+**	- `s_texture_file_header`, with the offset and size of each level
+**	- the levels, largest first, each one starting at a multiple of
+**	  `TEXTURE_FILE_ALIGNMENT` bytes
+*/
+
+//! The first bytes of every texture file
+#define TEXTURE_FILE_MAGIC		"GTEX"
+//! The version of the layout, which changes whenever the header does
+#define TEXTURE_FILE_VERSION	1
+//! The most levels in a mip chain (enough for 32768x32768)
+#define TEXTURE_FILE_MAX_LEVELS	16
+//! The alignment of each level in the file, in bytes
+#define TEXTURE_FILE_ALIGNMENT	16
+
+//! How the texels of a texture file are stored
+typedef enum texture_format
+{
+	TEXTURE_FORMAT_RGBA8,	//!< Uncompressed, 4 bytes per texel
+	TEXTURE_FORMAT_BC1,		//!< S3TC/DXT1: 8 bytes per 4x4 block, opaque
+	TEXTURE_FORMAT_BC3,		//!< S3TC/DXT5: 16 bytes per 4x4 block, with alpha
+	TEXTURE_FORMAT_BC7,		//!< BPTC: 16 bytes per 4x4 block, with alpha
+	TEXTURE_FORMAT_ETC2,	//!< ETC2 RGBA8 with EAC alpha: 16 bytes per 4x4 block
+	ENUMLENGTH_TEXTURE_FORMAT
+}	e_texture_format;
+
+//! What a texture format looks like to GL
+typedef struct texture_format_info
+{
+	char const*	name;			//!< The name given to the `texconv` tool
+	GLenum		internal_format;
+	int			block_size;		//!< The width and height of a block, in texels (1 if uncompressed)
+	int			block_bytes;	//!< The size of a block, in bytes
+}	s_texture_format_info;
+
+//! Where a level lies in the file
+typedef struct texture_file_level
+{
+	uint64_t	offset;		//!< From the start of the file, in bytes
+	uint64_t	size;		//!< In bytes
+}	s_texture_file_level;
+
+//! The start of every texture file (288 bytes)
+typedef struct texture_file_header
+{
+	char					magic[4];		//!< `TEXTURE_FILE_MAGIC`
+	uint32_t				version;		//!< `TEXTURE_FILE_VERSION`
+	uint32_t				format;			//!< An `e_texture_format`
+	uint32_t				width;			//!< The size of the first level, in texels
+	uint32_t				height;
+	uint32_t				level_count;	//!< The amount of levels in the mip chain (at least 1)
+	uint32_t				padding[2];
+	s_texture_file_level	levels[TEXTURE_FILE_MAX_LEVELS];
+}	s_texture_file_header;
+
+//! A texture file, mapped into memory
+typedef struct texture_file
+{
+	s_texture_file_header const*	header;	//!< The start of the mapping
+	size_t							size;	//!< The size of the file, in bytes
+#if defined(_WIN32)
+	void*							file;	//!< The file handle
+	void*							mapping;	//!< The file mapping handle
+#endif
+}	s_texture_file;
+
+//! Returns what a texture format looks like to GL
+s_texture_format_info const*	texture_format_info(e_texture_format format);
+//! Returns the texture format of the given name (like "bc7"), or `-1` if there is none
+int		texture_format_find(char const* name);
+//! Returns the size of a level of the given size in texels, in bytes
+size_t	texture_format_level_size(e_texture_format format, int width, int height);
+
+//! Maps a texture file into memory, and checks that its header is valid, returns `0` on success
+/*!
+**	@returns
+**	`0` on success, `-1` if the file could not be mapped or is not a valid texture file (a message is printed to `stderr`)
+*/
+int		texture_file_map(s_texture_file* file, char const* path);
+//! Unmaps a texture file
+void	texture_file_unmap(s_texture_file* file);
+//! Returns the texels of a level of a mapped texture file
+void const*	texture_file_level(s_texture_file const* file, int level);
+
+//! Encodes an image in the given format, with its mip chain, and writes it as a texture file
+/*!
+**	@param path		The file to write
+**	@param format	The format to store the texels in (ETC2 has no encoder: it can only be loaded)
+**	@param pixels	The image, as tightly packed RGBA bytes, first row at `t = 0`
+**	@param mipmaps	If nonzero, the whole mip chain is stored (box filtered), otherwise only the image itself
+**	@returns
+**	`0` on success, `-1` on failure (a message is printed to `stderr`)
+*/
+int		texture_file_write(char const* path, e_texture_format format, uint8_t const* pixels, int width, int height,
+			int mipmaps);
+
+#endif
@@ -0,0 +1,141 @@
+
+#include <stdio.h>
+#include <string.h>
+
+#include "uniforms.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+
+//! A field of a block, and where its C struct puts it
+typedef struct uniform_field
+{
+	char const*	name;
+	size_t		offset;
+}	s_uniform_field;
+
+//! What is known of each block, on the C side
+typedef struct uniform_block_info
+{
+	char const*				name;
+	size_t					size;
+	s_uniform_field const*	fields;
+	size_t					field_count;
+}	s_uniform_block_info;
+
+#define FIELD_INFO(block, TYPE, name)	{ #name, offsetof(s_uniform_##block, name) },
+#define BLOCK_FIELDS(NAME, name)		static s_uniform_field const	name##_fields[] = { UNIFORM_BLOCK_##NAME(FIELD_INFO, name) };
+#define BLOCK_INFO(NAME, name)			{ #NAME, sizeof(s_uniform_##name), name##_fields, sizeof(name##_fields) / sizeof(name##_fields[0]) },
+
+UNIFORM_BLOCKS(BLOCK_FIELDS)
+
+static s_uniform_block_info const	blocks[ENUMLENGTH_UNIFORM_BLOCK] =
+{
+	UNIFORM_BLOCKS(BLOCK_INFO)
+};
+
+//! Checks that the driver laid out each field of a block where its C struct has it
+static int	check_layout(GLuint program, s_uniform_block_info const* block)
+{
+	GLuint index;
+	GLint offset;
+	size_t i;
+	int status = 0;
+
+	for (i = 0; i < block->field_count; ++i)
+	{
+		glGetUniformIndices(program, 1, &block->fields[i].name, &index);
+		/* a field which the shaders don't use may have been optimized out */
+		if (index == GL_INVALID_INDEX)
+			continue;
+		glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_OFFSET, &offset);
+		if (offset != (GLint)block->fields[i].offset)
+		{
+			fprintf(stderr, "error: the field '%s' of the uniform block '%s' is at offset %d, instead of %zu\n",
+				block->fields[i].name, block->name, offset, block->fields[i].offset);
+			status = -1;
+		}
+	}
+	return status;
+}
+
+int		uniforms_bind_blocks(GLuint program)
+{
+	GLuint index;
+	GLint size;
+	int block;
+	int status = 0;
+
+	for (block = 0; block < ENUMLENGTH_UNIFORM_BLOCK; ++block)
+	{
+		index = glGetUniformBlockIndex(program, blocks[block].name);
+		if (index == GL_INVALID_INDEX)
+			continue;
+		glUniformBlockBinding(program, index, (GLuint)block);
+		glGetActiveUniformBlockiv(program, index, GL_UNIFORM_BLOCK_DATA_SIZE, &size);
+		if ((size_t)size > blocks[block].size)
+		{
+			fprintf(stderr, "error: the uniform block '%s' takes %d bytes, instead of %zu\n",
+				blocks[block].name, size, blocks[block].size);
+			status = -1;
+		}
+		if (check_layout(program, &blocks[block]))
+			status = -1;
+	}
+	return status;
+}
+
+int		uniforms_init(s_uniforms* uniforms, size_t frame_size)
+{
+	memset(uniforms, 0, sizeof(s_uniforms));
+	uniforms->frame_size = (frame_size ? frame_size : UNIFORMS_DEFAULT_FRAME_SIZE);
+	uniforms->alignment = (size_t)gl_caps.uniform_buffer_offset_alignment;
+	return gpu_ring_init(&uniforms->ring, GPU_RING_FRAMES * uniforms->frame_size);
+}
+
+void	uniforms_free(s_uniforms* uniforms)
+{
+	gpu_ring_free(&uniforms->ring);
+	memset(uniforms, 0, sizeof(s_uniforms));
+}
+
+int		uniforms_begin(s_uniforms* uniforms)
+{
+	uniforms->used = 0;
+	uniforms->frame = (uint8_t*)gpu_ring_alloc(&uniforms->ring, uniforms->frame_size, uniforms->alignment, &uniforms->offset);
+	if (!uniforms->frame)
+	{
+		fprintf(stderr, "error: could not map the uniform buffer\n");
+		return -1;
+	}
+	return 0;
+}
+
+void*	uniforms_push(s_uniforms* uniforms, e_uniform_block block, GLintptr* offset)
+{
+	size_t start = (uniforms->used + uniforms->alignment - 1) / uniforms->alignment * uniforms->alignment;
+
+	if (!uniforms->frame || start + blocks[block].size > uniforms->frame_size)
+		return NULL;
+	uniforms->used = start + blocks[block].size;
+	++uniforms->pushed;
+	*offset = (GLintptr)(uniforms->offset + start);
+	return uniforms->frame + start;
+}
+
+void	uniforms_upload(s_uniforms* uniforms)
+{
+	/* with a persistent mapping, the blocks are in the buffer already */
+	gpu_ring_flush(&uniforms->ring);
+}
+
+void	uniforms_bind(s_uniforms const* uniforms, e_uniform_block block, GLintptr offset)
+{
+	gl_state_bind_buffer_range(GL_UNIFORM_BUFFER, (GLuint)block, uniforms->ring.buffer,
+		offset, (GLsizeiptr)blocks[block].size);
+}
+
+void	uniforms_end(s_uniforms* uniforms)
+{
+	gpu_ring_fence(&uniforms->ring);
+	uniforms->frame = NULL;
+}
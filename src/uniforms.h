@@ -0,0 +1,154 @@
+#ifndef UNIFORMS_H
+#define UNIFORMS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <glad/glad.h>
+
+#include "gpu_ring.h"
+
+/*
+**	Uniform blocks, streamed through a ring buffer: each block is declared
+**	once below, as a list of fields, from which both its C struct (laid out
+**	the way std140 lays out the GLSL block) and its GLSL declaration are
+**	generated. Each frame, every block instance the frame needs is written
+**	into one range of a large uniform buffer (`uniforms_begin()` ...
+**	`uniforms_upload()`), and then bound for each draw with
+**	`glBindBufferRange()`: thousands of objects cost one upload, instead of
+**	thousands of `glUniform*()` calls.
+**	The GLSL blocks have no instance name, so field names must be unique
+**	across all blocks.
+*/
+
+/*
+**	The std140 types which blocks can use, with their std140 alignment. There
+**	is no vec3: std140 would pack a following scalar into its 4th component,
+**	which a C struct can't do - use a vec4 instead.
+*/
+
+typedef struct std140_vec2
+{
+	_Alignas(8) float	v[2];
+}	s_std140_vec2;
+
+typedef struct std140_vec4
+{
+	_Alignas(16) float	v[4];
+}	s_std140_vec4;
+
+typedef struct std140_ivec4
+{
+	_Alignas(16) int32_t	v[4];
+}	s_std140_ivec4;
+
+//! A column-major 4x4 matrix (4 vec4 columns)
+typedef struct std140_mat4
+{
+	_Alignas(16) float	m[16];
+}	s_std140_mat4;
+
+#define STD140_C_FLOAT		float
+#define STD140_C_INT		int32_t
+#define STD140_C_VEC2		s_std140_vec2
+#define STD140_C_VEC4		s_std140_vec4
+#define STD140_C_IVEC4		s_std140_ivec4
+#define STD140_C_MAT4		s_std140_mat4
+
+#define STD140_GLSL_FLOAT	"float"
+#define STD140_GLSL_INT		"int"
+#define STD140_GLSL_VEC2	"vec2"
+#define STD140_GLSL_VEC4	"vec4"
+#define STD140_GLSL_IVEC4	"ivec4"
+#define STD140_GLSL_MAT4	"mat4"
+
+/*
+**	The blocks: `UNIFORM_BLOCKS` lists them all (their binding point is their
+**	position in it), and `UNIFORM_BLOCK_<NAME>` lists the fields of each, as
+**	`FIELD(block, TYPE, name)`.
+*/
+
+#define UNIFORM_BLOCKS(BLOCK) \
+	BLOCK(FRAME,  frame) \
+	BLOCK(OBJECT, object)
+
+//! What is the same for every draw of a frame
+#define UNIFORM_BLOCK_FRAME(FIELD, block) \
+	FIELD(block, MAT4,  view_projection) \
+	FIELD(block, VEC4,  light_direction) \
+	FIELD(block, FLOAT, time)
+
+//! What changes with each object
+#define UNIFORM_BLOCK_OBJECT(FIELD, block) \
+	FIELD(block, MAT4,  model) \
+	FIELD(block, VEC4,  color)
+
+#define UNIFORM_ENUM(NAME, name)					UNIFORM_##NAME,
+#define UNIFORM_C_FIELD(block, TYPE, name)			STD140_C_##TYPE name;
+#define UNIFORM_C_STRUCT(NAME, name)				typedef struct uniform_##name { UNIFORM_BLOCK_##NAME(UNIFORM_C_FIELD, name) } s_uniform_##name;
+#define UNIFORM_GLSL_FIELD(block, TYPE, name)		"\t" STD140_GLSL_##TYPE " " #name ";\n"
+
+//! The GLSL declaration of a block, to paste into shader sources (like `UNIFORM_GLSL(OBJECT)`)
+#define UNIFORM_GLSL(NAME)	"layout(std140) uniform " #NAME "\n{\n" UNIFORM_BLOCK_##NAME(UNIFORM_GLSL_FIELD, NAME) "};\n"
+
+//! The uniform blocks, which are also their binding points
+typedef enum uniform_block
+{
+	UNIFORM_BLOCKS(UNIFORM_ENUM)
+	ENUMLENGTH_UNIFORM_BLOCK
+}	e_uniform_block;
+
+//! The C structs of the blocks: `s_uniform_frame`, `s_uniform_object`...
+UNIFORM_BLOCKS(UNIFORM_C_STRUCT)
+
+//! The default amount of bytes reserved for the blocks of a frame
+#define UNIFORMS_DEFAULT_FRAME_SIZE	(4 << 20)
+
+//! The uniform buffer, and the range of it which the current frame writes to
+typedef struct uniforms
+{
+	s_gpu_ring	ring;
+	size_t		frame_size;	//!< The amount of bytes reserved for each frame
+	size_t		alignment;	//!< The alignment of each block in the buffer
+	uint8_t*	frame;		//!< Where the current frame's range is mapped (`NULL` outside of a frame)
+	size_t		offset;		//!< The offset of the current frame's range in the buffer
+	size_t		used;		//!< The amount of bytes of the current frame's range which were pushed
+	long		pushed;		//!< The amount of blocks pushed since `uniforms_init()`
+}	s_uniforms;
+
+//! Binds the blocks which a program uses to their binding points, and checks their layout, returns `0` on success
+/*!
+**	Call it once, after linking the program. The offset of each field, as
+**	given by the driver, is checked against the C struct of its block.
+*/
+int		uniforms_bind_blocks(GLuint program);
+
+//! Creates the uniform buffer, returns `0` on success
+/*!
+**	@param uniforms		The uniform buffer to set up
+**	@param frame_size	The most bytes of blocks which a frame can push (`0` for `UNIFORMS_DEFAULT_FRAME_SIZE`),
+**						including the padding which aligns each block: the buffer holds `GPU_RING_FRAMES` frames
+*/
+int		uniforms_init(s_uniforms* uniforms, size_t frame_size);
+//! Deletes the uniform buffer
+void	uniforms_free(s_uniforms* uniforms);
+
+//! Reserves the range of the buffer which the blocks of a new frame are written to, returns `0` on success
+int		uniforms_begin(s_uniforms* uniforms);
+//! Adds a block to the frame, and returns it so that the caller fills it in
+/*!
+**	@param uniforms	The uniform buffer
+**	@param block	Which block it is: the result points to its C struct
+**	@param offset	Receives the offset of the block in the buffer, to give to `uniforms_bind()`
+**	@returns
+**	Where to write the block, or `NULL` if the frame's range is full
+*/
+void*	uniforms_push(s_uniforms* uniforms, e_uniform_block block, GLintptr* offset);
+//! Makes the blocks pushed so far visible to the GL: must be called after pushing, and before drawing
+void	uniforms_upload(s_uniforms* uniforms);
+//! Binds a block which was pushed this frame to its binding point
+void	uniforms_bind(s_uniforms const* uniforms, e_uniform_block block, GLintptr offset);
+//! Ends the frame: its range is reused once the GL is done drawing it
+void	uniforms_end(s_uniforms* uniforms);
+
+#endif
@@ -0,0 +1,225 @@
+
+#include <stdio.h>
+#include <string.h>
+
+#include "uploader.h"
+#include "gl_caps.h"
+
+/*
+**	The worker thread's context has bindings of its own: it binds objects
+**	with plain GL calls, since `gl_state` tracks the renderer's context only.
+*/
+
+//! Puts an upload at the end of a queue (producer side), returns `0` on success or `-1` if it is full
+static int	queue_push(s_upload_queue* queue, s_upload const* upload)
+{
+	size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+	if (tail - atomic_load_explicit(&queue->head, memory_order_acquire) == UPLOADER_QUEUE)
+		return -1;
+	queue->items[tail % UPLOADER_QUEUE] = *upload;
+	/* the item is written before the consumer can see it */
+	atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+	return 0;
+}
+
+//! Returns the upload at the front of a queue (consumer side), or `NULL` if it is empty
+static s_upload*	queue_front(s_upload_queue* queue)
+{
+	size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+	if (head == atomic_load_explicit(&queue->tail, memory_order_acquire))
+		return NULL;
+	return &queue->items[head % UPLOADER_QUEUE];
+}
+
+//! Removes the upload at the front of a queue (consumer side), once it was read
+static void	queue_pop(s_upload_queue* queue)
+{
+	atomic_fetch_add_explicit(&queue->head, 1, memory_order_release);
+}
+
+//! Returns the amount of bytes of data of an upload
+static size_t	upload_size(s_upload const* upload)
+{
+	if (upload->kind == UPLOAD_TEXTURE)
+		return (size_t)upload->width * (size_t)upload->height * 4;
+	return upload->size;
+}
+
+//! Creates the object of an upload from the data in `staging` (bound to `GL_PIXEL_UNPACK_BUFFER`)
+static GLuint	create_object(s_upload const* upload, GLuint staging, size_t size)
+{
+	GLuint object;
+
+	if (upload->kind == UPLOAD_BUFFER)
+	{
+		glGenBuffers(1, &object);
+		glBindBuffer(GL_COPY_READ_BUFFER, staging);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, object);
+		glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)size, NULL, GL_STATIC_DRAW);
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, (GLsizeiptr)size);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+		return object;
+	}
+	glGenTextures(1, &object);
+	glBindTexture(GL_TEXTURE_2D, object);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	/* the pixels are read from the unpack buffer: the pointer is an offset in it */
+	if (gl_caps.texture_storage)
+	{
+		glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, upload->width, upload->height);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, upload->width, upload->height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	}
+	else
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, upload->width, upload->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	return object;
+}
+
+//! Copies the data of an upload into the staging buffer, creates its object, and fences it
+static void	upload_one(s_upload* upload, GLuint staging)
+{
+	size_t size = upload_size(upload);
+	void* mapped;
+
+	upload->object = 0;
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, staging);
+	/* orphaned: if the GPU still reads the last upload from it, the driver gives it new storage */
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)size, NULL, GL_STREAM_DRAW);
+	mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)size,
+		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+	if (mapped)
+	{
+		memcpy(mapped, upload->data, size);
+		if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER))
+			upload->object = create_object(upload, staging, size);
+	}
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	upload->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	/* the renderer's context waits for the fence: it must be submitted, or it may never be signaled */
+	glFlush();
+}
+
+//! Does the submitted uploads, with a context of its own, until the uploader is freed
+static void*	worker_run(void* data)
+{
+	s_uploader* uploader = (s_uploader*)data;
+	s_upload upload;
+	s_upload* job;
+	GLuint staging;
+	int quit;
+
+	window_make_current(uploader->window);
+	glGenBuffers(1, &staging);
+	for (;;)
+	{
+		pthread_mutex_lock(&uploader->lock);
+		while (!queue_front(&uploader->jobs) && !uploader->quit)
+			pthread_cond_wait(&uploader->queued, &uploader->lock);
+		quit = uploader->quit;
+		pthread_mutex_unlock(&uploader->lock);
+		if (quit)
+			break;
+		while ((job = queue_front(&uploader->jobs)))
+		{
+			upload = *job;
+			queue_pop(&uploader->jobs);
+			upload_one(&upload, staging);
+			/* there is always room: no more than `UPLOADER_QUEUE` uploads are ever in flight */
+			queue_push(&uploader->done, &upload);
+		}
+	}
+	glDeleteBuffers(1, &staging);
+	window_make_current(NULL);
+	return NULL;
+}
+
+int		uploader_init(s_uploader* uploader, s_window* window)
+{
+	memset(uploader, 0, sizeof(s_uploader));
+	atomic_init(&uploader->jobs.head, 0);
+	atomic_init(&uploader->jobs.tail, 0);
+	atomic_init(&uploader->done.head, 0);
+	atomic_init(&uploader->done.tail, 0);
+	if (!(uploader->window = window_create_shared(window)))
+	{
+		fprintf(stderr, "error: could not create the uploader's context\n");
+		return -1;
+	}
+	pthread_mutex_init(&uploader->lock, NULL);
+	pthread_cond_init(&uploader->queued, NULL);
+	if (pthread_create(&uploader->worker, NULL, worker_run, uploader))
+	{
+		fprintf(stderr, "error: could not start the uploader's thread\n");
+		pthread_mutex_destroy(&uploader->lock);
+		pthread_cond_destroy(&uploader->queued);
+		window_destroy(uploader->window);
+		uploader->window = NULL;
+		return -1;
+	}
+	return 0;
+}
+
+void	uploader_free(s_uploader* uploader)
+{
+	s_upload* upload;
+
+	if (!uploader->window)
+		return;
+	pthread_mutex_lock(&uploader->lock);
+	uploader->quit = 1;
+	pthread_cond_signal(&uploader->queued);
+	pthread_mutex_unlock(&uploader->lock);
+	pthread_join(uploader->worker, NULL);
+	window_destroy(uploader->window);
+	uploader->window = NULL;
+	/* the GPU may still be creating them: GL deletes them once it is done */
+	while ((upload = queue_front(&uploader->done)))
+	{
+		glDeleteSync(upload->fence);
+		if (upload->kind == UPLOAD_TEXTURE)
+			glDeleteTextures(1, &upload->object);
+		else
+			glDeleteBuffers(1, &upload->object);
+		queue_pop(&uploader->done);
+	}
+	uploader->in_flight = 0;
+	pthread_mutex_destroy(&uploader->lock);
+	pthread_cond_destroy(&uploader->queued);
+}
+
+int		uploader_submit(s_uploader* uploader, s_upload const* upload)
+{
+	if (uploader->in_flight == UPLOADER_QUEUE || upload_size(upload) == 0 ||
+		queue_push(&uploader->jobs, upload))
+		return -1;
+	++uploader->in_flight;
+	/* the lock is only taken so that the worker can't miss the wake-up, between its check and its wait */
+	pthread_mutex_lock(&uploader->lock);
+	pthread_cond_signal(&uploader->queued);
+	pthread_mutex_unlock(&uploader->lock);
+	return 0;
+}
+
+int		uploader_poll(s_uploader* uploader, s_upload* upload)
+{
+	s_upload* front = queue_front(&uploader->done);
+
+	/* uploads are fenced in order: if the oldest isn't done, none is */
+	if (!front || glClientWaitSync(front->fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+		return 0;
+	glDeleteSync(front->fence);
+	*upload = *front;
+	upload->fence = NULL;
+	queue_pop(&uploader->done);
+	--uploader->in_flight;
+	++uploader->uploads;
+	uploader->bytes += upload_size(upload);
+	return 1;
+}
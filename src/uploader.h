@@ -0,0 +1,97 @@
+#ifndef UPLOADER_H
+#define UPLOADER_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+#include <pthread.h>
+
+#include <glad/glad.h>
+
+#include "window.h"
+
+/*
+**	Uploads textures and buffers on a worker thread, so that loading large
+**	assets doesn't stall the frames. The worker has a helper context which
+**	shares objects with the renderer's: it copies the data into a pixel
+**	buffer (orphaned for each upload, so that it never waits for the GPU),
+**	creates the object from it, and places a fence after the copy.
+**	Uploads are handed to the worker, and handed back once done, through two
+**	single-producer single-consumer queues which take no lock (the lock is
+**	only taken to wake the worker up). The renderer polls for the uploads
+**	which are done, without blocking: an object is only handed back once its
+**	fence is signaled, so that it is complete when the renderer draws with it.
+*/
+
+//! The most uploads which can be in flight at once (a power of 2)
+#define UPLOADER_QUEUE	64
+
+//! What an upload creates
+typedef enum upload_kind
+{
+	UPLOAD_TEXTURE,	//!< A 2D RGBA8 texture, with linear filtering and no mipmaps (like `gl_create_texture_rgba8()`)
+	UPLOAD_BUFFER,	//!< A buffer with `GL_STATIC_DRAW` storage, for any target
+	ENUMLENGTH_UPLOAD_KIND
+}	e_upload_kind;
+
+//! An upload, as it is submitted and handed back
+typedef struct upload
+{
+	e_upload_kind	kind;
+	void const*		data;		//!< The data to upload: it must stay valid until the upload is handed back
+	size_t			size;		//!< The amount of bytes of data, for a buffer
+	int				width;		//!< The size of a texture, in pixels (its data is tightly packed RGBA bytes)
+	int				height;
+	void*			user;		//!< Anything, for the caller to know which upload it is
+	GLuint			object;		//!< The texture or buffer, once handed back (`0` if it could not be created)
+	GLsync			fence;		//!< Signaled once the object is complete (only used by the uploader)
+}	s_upload;
+
+//! A single-producer single-consumer queue of uploads, which takes no lock
+typedef struct upload_queue
+{
+	s_upload		items[UPLOADER_QUEUE];
+	atomic_size_t	head;		//!< The amount of uploads which were taken out (only written by the consumer)
+	atomic_size_t	tail;		//!< The amount of uploads which were put in (only written by the producer)
+}	s_upload_queue;
+
+//! The worker thread, and the uploads in flight
+typedef struct uploader
+{
+	s_window*		window;		//!< The helper window whose context the worker thread uploads with
+	pthread_t		worker;
+	pthread_mutex_t	lock;		//!< Only protects the worker's sleep, and `quit`
+	pthread_cond_t	queued;		//!< Signaled when an upload is submitted, or when the worker must quit
+	int				quit;
+	s_upload_queue	jobs;		//!< The uploads which the worker has yet to do
+	s_upload_queue	done;		//!< The uploads which the worker did, oldest first
+	int				in_flight;	//!< The amount of uploads which were submitted, but not handed back yet
+	long			uploads;	//!< The amount of uploads which were handed back
+	size_t			bytes;		//!< The amount of bytes which were handed back
+}	s_uploader;
+
+//! Starts the worker thread, with a context which shares objects with the one of `window`, returns `0` on success
+/*!
+**	@param uploader	The uploader to set up (the context of `window` must be current)
+**	@param window	The window whose context draws with the uploaded objects
+*/
+int		uploader_init(s_uploader* uploader, s_window* window);
+//! Stops the worker thread: uploads which were not handed back are dropped, and their objects deleted
+void	uploader_free(s_uploader* uploader);
+
+//! Hands an upload to the worker thread, without waiting for it
+/*!
+**	@returns
+**	`0` on success, or `-1` if `UPLOADER_QUEUE` uploads are in flight already, or the upload is empty
+*/
+int		uploader_submit(s_uploader* uploader, s_upload const* upload);
+//! Takes back the oldest upload, if it is done (it never waits)
+/*!
+**	@param uploader	The uploader
+**	@param upload	Receives the upload, with its `object`: it now belongs to the caller
+**	@returns
+**	`1` if an upload was handed back, `0` if none is done yet
+*/
+int		uploader_poll(s_uploader* uploader, s_upload* upload);
+
+#endif
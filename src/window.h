@@ -0,0 +1,99 @@
+#ifndef WINDOW_H
+#define WINDOW_H
+
+#include <stdint.h>
+
+#include <glad/glad.h>
+
+/*
+**	The windowing system, which owns the OpenGL context and the framebuffer
+**	which frames are rendered into. One implementation is compiled in,
+**	according to the WINDOWER chosen in the Makefile:
+**	- `window_glfw.c`: an on-screen window, from GLFW
+**	- `window_egl.c`: headless, an offscreen framebuffer on a surfaceless EGL
+**	  context - which needs no display server, and no GPU with Mesa llvmpipe
+*/
+
+//! A window (or offscreen surface) with its own OpenGL context
+typedef struct window	s_window;
+
+//! Initializes the windowing system, returns `0` on success
+int		window_init(void);
+//! Shuts down the windowing system, once every window has been destroyed
+void	window_terminate(void);
+
+//! Creates a window with an OpenGL (4.0 or later) core profile context
+/*!
+**	@param width	The width of the framebuffer, in pixels
+**	@param height	The height of the framebuffer, in pixels
+**	@param title	The window title (ignored when headless)
+**	@param visible	If zero, the window is hidden (for benchmarks and helper contexts)
+**	@returns
+**	The new window, or `NULL` if it could not be created
+*/
+s_window*	window_create(int width, int height, char const* title, int visible);
+//! Creates a hidden helper window, whose context shares its objects with the context of `share`
+/*!
+**	This is for worker threads which create GL objects (compile programs, upload
+**	textures) while `share` renders: make it current on the worker thread. The GL
+**	functions must have been loaded for `share` already, and the helper needs no
+**	`window_load_gl()`.
+**	@returns
+**	The new window, or `NULL` if it could not be created
+*/
+s_window*	window_create_shared(s_window* share);
+//! Destroys the given window and its context
+void		window_destroy(s_window* window);
+
+//! Makes the context of `window` current on the calling thread (or none at all, if `NULL`)
+/*!
+**	A context can only be current on one thread at a time: the thread which had it must release it first.
+*/
+void	window_make_current(s_window* window);
+
+//! Loads the OpenGL functions for the current context, and sets up the framebuffer of `window`
+/*!
+**	@param window	The window whose context is current
+**	@param lazy		If nonzero, GL entry points are resolved on their first call
+**	@returns
+**	`1` on success, `0` on failure (like the glad loaders)
+*/
+int		window_load_gl(s_window* window, int lazy);
+
+//! Returns the framebuffer object which frames are rendered into (0 is the default framebuffer)
+GLuint	window_framebuffer(s_window const* window);
+//! Gets the size of the framebuffer which frames are rendered into, in pixels
+void	window_framebuffer_size(s_window const* window, int* width, int* height);
+
+//! Sets how many vertical blanks each swap waits for (0: none, 1: vsync, -1: adaptive vsync)
+void	window_set_swap_interval(s_window* window, int interval);
+//! Returns nonzero if adaptive vsync (a negative swap interval) is supported
+int		window_adaptive_sync_supported(void);
+//! Returns the refresh rate of the display which shows `window`, in Hz (0 if unknown or headless)
+int		window_refresh_rate(s_window const* window);
+
+//! Sets the title of the window (ignored when headless)
+void	window_set_title(s_window* window, char const* title);
+
+//! Returns nonzero once the window has been asked to close (or the process was interrupted)
+int		window_should_close(s_window const* window);
+//! Presents the frame which was just rendered
+void	window_swap_buffers(s_window* window);
+//! Processes any pending events, without waiting
+void	window_poll_events(void);
+//! Waits until at least one event arrives, then processes the pending events
+/*!
+**	@param timeout	The longest time to wait, in seconds (or no limit, if negative)
+*/
+void	window_wait_events(double timeout);
+//! Wakes up `window_wait_events()` - this can be called from any thread
+void	window_post_empty_event(void);
+//! Returns nonzero if the window got input, was resized or needs redrawing, since the last call
+int		window_take_damage(s_window* window);
+
+//! Returns the current value of the high-resolution timer, in ticks
+uint64_t	window_timer_value(void);
+//! Returns the frequency of the high-resolution timer, in ticks per second
+uint64_t	window_timer_frequency(void);
+
+#endif
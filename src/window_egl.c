@@ -0,0 +1,364 @@
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <glad/glad.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include "window.h"
+
+/*
+**	Headless implementation: there is no window at all, the context is
+**	created on a surfaceless EGL display (Mesa's surfaceless platform, or the
+**	first EGL device), and frames are rendered into an offscreen framebuffer
+**	object. This runs on render nodes and CI machines which have no display
+**	server, and (with Mesa llvmpipe) no GPU.
+*/
+
+struct window
+{
+	EGLContext	context;
+	EGLSurface	surface;	//!< A 1x1 pbuffer, only if the driver can't make a context current without a surface
+	int			width;
+	int			height;
+	GLuint		framebuffer;
+	GLuint		renderbuffers[2];	//!< The color and depth/stencil attachments of `framebuffer`
+	int			damaged;	//!< Only set at creation: there is no input, and the size never changes
+};
+
+static EGLDisplay	display = EGL_NO_DISPLAY;
+static EGLConfig	display_config;
+static int			display_surfaceless = 0;
+
+//! Set from the signal handler: headless windows have no close button, so Ctrl+C is how to stop
+static volatile sig_atomic_t	interrupted = 0;
+
+//! A pipe to itself, which `window_wait_events()` waits on: writing a byte wakes it up
+static int	wakeup[2] = { -1, -1 };
+
+static void	on_interrupt(int sig)
+{
+	char byte = 0;
+
+	(void)sig;
+	interrupted = 1;
+	if (wakeup[1] >= 0)
+		write(wakeup[1], &byte, 1);
+}
+
+static int	has_extension(char const* extensions, char const* name)
+{
+	size_t length = strlen(name);
+	char const* found;
+
+	while (extensions && (found = strstr(extensions, name)))
+	{
+		if ((found == extensions || found[-1] == ' ') &&
+			(found[length] == ' ' || found[length] == '\0'))
+			return 1;
+		extensions = found + length;
+	}
+	return 0;
+}
+
+//! Opens a display which needs no window system: Mesa's surfaceless platform, or else the first EGL device
+static EGLDisplay	open_display(void)
+{
+	char const* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+	PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display;
+	PFNEGLQUERYDEVICESEXTPROC query_devices;
+	EGLDisplay result = EGL_NO_DISPLAY;
+	EGLDeviceEXT device;
+	EGLint devices = 0;
+
+	get_platform_display = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	if (!get_platform_display)
+		return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	if (has_extension(extensions, "EGL_MESA_platform_surfaceless"))
+		result = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+	if (result == EGL_NO_DISPLAY && has_extension(extensions, "EGL_EXT_platform_device"))
+	{
+		query_devices = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+		if (query_devices && query_devices(1, &device, &devices) && devices > 0)
+			result = get_platform_display(EGL_PLATFORM_DEVICE_EXT, device, NULL);
+	}
+	return (result == EGL_NO_DISPLAY ? eglGetDisplay(EGL_DEFAULT_DISPLAY) : result);
+}
+
+int		window_init(void)
+{
+	static EGLint const config_attributes[] =
+	{
+		EGL_SURFACE_TYPE,		EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE,	EGL_OPENGL_BIT,
+		EGL_NONE
+	};
+	EGLint major, minor;
+	EGLint configs = 0;
+
+	display = open_display();
+	if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor))
+	{
+		fprintf(stderr, "error: could not initialize EGL (0x%04X)\n", eglGetError());
+		return -1;
+	}
+	if (!eglBindAPI(EGL_OPENGL_API) ||
+		!eglChooseConfig(display, config_attributes, &display_config, 1, &configs) || configs == 0)
+	{
+		fprintf(stderr, "error: this EGL implementation does not support desktop OpenGL\n");
+		eglTerminate(display);
+		display = EGL_NO_DISPLAY;
+		return -1;
+	}
+	display_surfaceless = has_extension(eglQueryString(display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context");
+	if (pipe(wakeup) == 0)
+	{
+		fcntl(wakeup[0], F_SETFL, O_NONBLOCK);
+		fcntl(wakeup[1], F_SETFL, O_NONBLOCK);
+	}
+	signal(SIGINT, on_interrupt);
+	signal(SIGTERM, on_interrupt);
+	return 0;
+}
+
+void	window_terminate(void)
+{
+	if (display == EGL_NO_DISPLAY)
+		return;
+	eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	eglTerminate(display);
+	eglReleaseThread();
+	display = EGL_NO_DISPLAY;
+	if (wakeup[0] >= 0)
+	{
+		close(wakeup[0]);
+		close(wakeup[1]);
+		wakeup[0] = -1;
+		wakeup[1] = -1;
+	}
+}
+
+//! Creates a window with a context which shares its objects with `share` (unless it is `EGL_NO_CONTEXT`)
+static s_window*	create(int width, int height, EGLContext share)
+{
+	static EGLint const context_attributes[] =
+	{
+		EGL_CONTEXT_MAJOR_VERSION,			4,
+		EGL_CONTEXT_MINOR_VERSION,			0,
+		EGL_CONTEXT_OPENGL_PROFILE_MASK,	EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+		EGL_NONE
+	};
+	static EGLint const surface_attributes[] =
+	{
+		EGL_WIDTH,	1,
+		EGL_HEIGHT,	1,
+		EGL_NONE
+	};
+	s_window* window;
+
+	window = (s_window*)calloc(1, sizeof(s_window));
+	if (!window)
+		return NULL;
+	window->width = width;
+	window->height = height;
+	window->damaged = 1;
+	window->surface = EGL_NO_SURFACE;
+	window->context = eglCreateContext(display, display_config, share, context_attributes);
+	if (window->context == EGL_NO_CONTEXT)
+	{
+		free(window);
+		return NULL;
+	}
+	if (!display_surfaceless)
+	{
+		window->surface = eglCreatePbufferSurface(display, display_config, surface_attributes);
+		if (window->surface == EGL_NO_SURFACE)
+		{
+			eglDestroyContext(display, window->context);
+			free(window);
+			return NULL;
+		}
+	}
+	return window;
+}
+
+s_window*	window_create(int width, int height, char const* title, int visible)
+{
+	(void)title;
+	(void)visible;
+	return create(width, height, EGL_NO_CONTEXT);
+}
+
+s_window*	window_create_shared(s_window* share)
+{
+	/* the helper never renders to its framebuffer: it gets none */
+	return create(1, 1, share->context);
+}
+
+void	window_destroy(s_window* window)
+{
+	if (!window)
+		return;
+	if (eglGetCurrentContext() == window->context)
+	{
+		if (window->framebuffer)
+		{
+			glDeleteFramebuffers(1, &window->framebuffer);
+			glDeleteRenderbuffers(2, window->renderbuffers);
+		}
+		eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	}
+	if (window->surface != EGL_NO_SURFACE)
+		eglDestroySurface(display, window->surface);
+	eglDestroyContext(display, window->context);
+	free(window);
+}
+
+void	window_make_current(s_window* window)
+{
+	/* the client API is per-thread state: a worker thread hasn't bound it yet */
+	eglBindAPI(EGL_OPENGL_API);
+	if (window)
+		eglMakeCurrent(display, window->surface, window->surface, window->context);
+	else
+		eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+static void*	get_proc_address(char const* name)
+{
+	return (void*)eglGetProcAddress(name);
+}
+
+int		window_load_gl(s_window* window, int lazy)
+{
+	int status = (lazy ?
+		gladLoadGLLoaderLazy(&get_proc_address) :
+		gladLoadGLLoader(&get_proc_address));
+	if (!status || window->framebuffer)
+		return status;
+	/* The offscreen framebuffer stands in for the window's default framebuffer */
+	glGenRenderbuffers(2, window->renderbuffers);
+	glBindRenderbuffer(GL_RENDERBUFFER, window->renderbuffers[0]);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, window->width, window->height);
+	glBindRenderbuffer(GL_RENDERBUFFER, window->renderbuffers[1]);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, window->width, window->height);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+	glGenFramebuffers(1, &window->framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, window->framebuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, window->renderbuffers[0]);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, window->renderbuffers[1]);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+	{
+		fprintf(stderr, "error: could not create the %dx%d offscreen framebuffer\n", window->width, window->height);
+		return 0;
+	}
+	glViewport(0, 0, window->width, window->height);
+	return status;
+}
+
+GLuint	window_framebuffer(s_window const* window)
+{
+	return window->framebuffer;
+}
+
+void	window_framebuffer_size(s_window const* window, int* width, int* height)
+{
+	*width = window->width;
+	*height = window->height;
+}
+
+void	window_set_swap_interval(s_window* window, int interval)
+{
+	/* nothing is ever presented, so there is no vertical blank to wait for */
+	(void)window;
+	(void)interval;
+}
+
+int		window_adaptive_sync_supported(void)
+{
+	return 0;
+}
+
+int		window_refresh_rate(s_window const* window)
+{
+	(void)window;
+	return 0;
+}
+
+void	window_set_title(s_window* window, char const* title)
+{
+	(void)window;
+	(void)title;
+}
+
+int		window_should_close(s_window const* window)
+{
+	(void)window;
+	return interrupted;
+}
+
+void	window_swap_buffers(s_window* window)
+{
+	(void)window;
+	/* nothing to present: just make sure the frame gets submitted */
+	glFlush();
+}
+
+void	window_poll_events(void)
+{
+}
+
+void	window_wait_events(double timeout)
+{
+	struct pollfd wait;
+	char bytes[64];
+
+	if (wakeup[0] < 0)
+		return;
+	wait.fd = wakeup[0];
+	wait.events = POLLIN;
+	/* round up, so as not to wake up just before a deadline */
+	while (poll(&wait, 1, (timeout < 0. ? -1 : (int)(timeout * 1000. + 0.999))) < 0 && errno == EINTR)
+	{
+		if (interrupted)
+			break;
+	}
+	/* the only events are wake-ups: consume them all at once */
+	while (read(wakeup[0], bytes, sizeof(bytes)) > 0)
+		;
+}
+
+void	window_post_empty_event(void)
+{
+	char byte = 0;
+
+	if (wakeup[1] >= 0)
+		write(wakeup[1], &byte, 1);
+}
+
+int		window_take_damage(s_window* window)
+{
+	int damaged = window->damaged;
+	window->damaged = 0;
+	return damaged;
+}
+
+uint64_t	window_timer_value(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+uint64_t	window_timer_frequency(void)
+{
+	return 1000000000u;
+}
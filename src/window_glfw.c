@@ -0,0 +1,212 @@
+
+#include <stdlib.h>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "window.h"
+
+struct window
+{
+	GLFWwindow*	handle;
+	int			damaged;	//!< Set by the input/resize/refresh callbacks, cleared by `window_take_damage()`
+};
+
+static void	on_damage(GLFWwindow* handle)
+{
+	((s_window*)glfwGetWindowUserPointer(handle))->damaged = 1;
+}
+
+static void	on_key(GLFWwindow* handle, int key, int scancode, int action, int mods)
+{
+	(void)key, (void)scancode, (void)action, (void)mods;
+	on_damage(handle);
+}
+
+static void	on_char(GLFWwindow* handle, unsigned int codepoint)
+{
+	(void)codepoint;
+	on_damage(handle);
+}
+
+static void	on_mouse_button(GLFWwindow* handle, int button, int action, int mods)
+{
+	(void)button, (void)action, (void)mods;
+	on_damage(handle);
+}
+
+static void	on_cursor_pos(GLFWwindow* handle, double x, double y)
+{
+	(void)x, (void)y;
+	on_damage(handle);
+}
+
+static void	on_scroll(GLFWwindow* handle, double x, double y)
+{
+	(void)x, (void)y;
+	on_damage(handle);
+}
+
+static void	on_framebuffer_size(GLFWwindow* handle, int width, int height)
+{
+	(void)width, (void)height;
+	on_damage(handle);
+}
+
+int		window_init(void)
+{
+	return (glfwInit() ? 0 : -1);
+}
+
+void	window_terminate(void)
+{
+	glfwTerminate();
+}
+
+//! Creates a window with a context which shares its objects with `share` (unless it is `NULL`)
+static s_window*	create(int width, int height, char const* title, int visible, GLFWwindow* share)
+{
+	s_window* window = (s_window*)malloc(sizeof(s_window));
+	if (!window)
+		return NULL;
+	/* Ask for a core profile context: the driver gives its highest version, 4.0 at least */
+	glfwDefaultWindowHints();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_TRUE);
+	glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
+	window->handle = glfwCreateWindow(width, height, title, NULL, share);
+	if (!window->handle)
+	{
+		free(window);
+		return NULL;
+	}
+	glfwSetWindowUserPointer(window->handle, window);
+	window->damaged = 1;
+	glfwSetKeyCallback(window->handle, on_key);
+	glfwSetCharCallback(window->handle, on_char);
+	glfwSetMouseButtonCallback(window->handle, on_mouse_button);
+	glfwSetCursorPosCallback(window->handle, on_cursor_pos);
+	glfwSetScrollCallback(window->handle, on_scroll);
+	glfwSetFramebufferSizeCallback(window->handle, on_framebuffer_size);
+	glfwSetWindowRefreshCallback(window->handle, on_damage);
+	return window;
+}
+
+s_window*	window_create(int width, int height, char const* title, int visible)
+{
+	return create(width, height, title, visible, NULL);
+}
+
+s_window*	window_create_shared(s_window* share)
+{
+	return create(1, 1, "", 0, share->handle);
+}
+
+void	window_destroy(s_window* window)
+{
+	if (!window)
+		return;
+	glfwDestroyWindow(window->handle);
+	free(window);
+}
+
+void	window_make_current(s_window* window)
+{
+	glfwMakeContextCurrent(window ? window->handle : NULL);
+}
+
+int		window_load_gl(s_window* window, int lazy)
+{
+	(void)window;
+	return (lazy ? gladLoadGLLazy() : gladLoadGL());
+}
+
+GLuint	window_framebuffer(s_window const* window)
+{
+	(void)window;
+	return 0;
+}
+
+void	window_framebuffer_size(s_window const* window, int* width, int* height)
+{
+	glfwGetFramebufferSize(window->handle, width, height);
+}
+
+void	window_set_swap_interval(s_window* window, int interval)
+{
+	(void)window;
+	glfwSwapInterval(interval);
+}
+
+int		window_adaptive_sync_supported(void)
+{
+	return (glfwExtensionSupported("GLX_EXT_swap_control_tear") ||
+		glfwExtensionSupported("WGL_EXT_swap_control_tear"));
+}
+
+int		window_refresh_rate(s_window const* window)
+{
+	GLFWmonitor* monitor = glfwGetWindowMonitor(window->handle);
+	GLFWvidmode const* mode;
+
+	/* a windowed window is shown on the primary monitor, as far as we can tell */
+	if (!monitor)
+		monitor = glfwGetPrimaryMonitor();
+	if (!monitor || !(mode = glfwGetVideoMode(monitor)))
+		return 0;
+	return mode->refreshRate;
+}
+
+void	window_set_title(s_window* window, char const* title)
+{
+	glfwSetWindowTitle(window->handle, title);
+}
+
+int		window_should_close(s_window const* window)
+{
+	return glfwWindowShouldClose(window->handle);
+}
+
+void	window_swap_buffers(s_window* window)
+{
+	glfwSwapBuffers(window->handle);
+}
+
+void	window_poll_events(void)
+{
+	glfwPollEvents();
+}
+
+void	window_wait_events(double timeout)
+{
+	if (timeout < 0.)
+		glfwWaitEvents();
+	else if (timeout > 0.)
+		glfwWaitEventsTimeout(timeout);
+	else
+		glfwPollEvents();
+}
+
+void	window_post_empty_event(void)
+{
+	glfwPostEmptyEvent();
+}
+
+int		window_take_damage(s_window* window)
+{
+	int damaged = window->damaged;
+	window->damaged = 0;
+	return damaged;
+}
+
+uint64_t	window_timer_value(void)
+{
+	return glfwGetTimerValue();
+}
+
+uint64_t	window_timer_frequency(void)
+{
+	return glfwGetTimerFrequency();
+}
@@ -0,0 +1,81 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "image_png.h"
+#include "texture_file.h"
+
+/*
+**	The offline converter of textures: decodes a PNG image, builds its mip
+**	chain, encodes it, and writes it as a texture file which the program
+**	maps and hands to GL as it is (see `texture_file.h`).
+**	Built by `make tools`.
+*/
+
+static void	usage(char const* program)
+{
+	int i;
+
+	fprintf(stderr,
+		"usage: %s [options] <input.png> <output.gtex>\n"
+		"  --format <name>  how texels are stored (default: rgba8), one of:",
+		program);
+	for (i = 0; i < ENUMLENGTH_TEXTURE_FORMAT; ++i)
+	{
+		if (i != TEXTURE_FORMAT_ETC2)
+			fprintf(stderr, " %s", texture_format_info((e_texture_format)i)->name);
+	}
+	fprintf(stderr, "\n"
+		"  --no-mipmaps     only store the image itself, not its mip chain\n"
+		"  --help           show this message\n");
+}
+
+int main(int argc, char** argv)
+{
+	char const* paths[2] = { NULL, NULL };
+	int format = TEXTURE_FORMAT_RGBA8;
+	int mipmaps = 1;
+	int count = 0;
+	uint8_t* pixels;
+	int width, height;
+	int status;
+	int i;
+
+	for (i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+		{
+			if ((format = texture_format_find(argv[++i])) < 0)
+			{
+				fprintf(stderr, "error: unknown texture format '%s'\n", argv[i]);
+				usage(argv[0]);
+				return -1;
+			}
+		}
+		else if (strcmp(argv[i], "--no-mipmaps") == 0)
+			mipmaps = 0;
+		else if (argv[i][0] != '-' && count < 2)
+			paths[count++] = argv[i];
+		else
+		{
+			if (strcmp(argv[i], "--help") != 0)
+				fprintf(stderr, "error: unexpected argument '%s'\n", argv[i]);
+			usage(argv[0]);
+			return -1;
+		}
+	}
+	if (count != 2)
+	{
+		usage(argv[0]);
+		return -1;
+	}
+	if (!(pixels = image_png_load(paths[0], &width, &height)))
+		return -1;
+	status = texture_file_write(paths[1], (e_texture_format)format, pixels, width, height, mipmaps);
+	if (status == 0)
+		printf("%s: %dx%d, %s%s\n", paths[1], width, height, texture_format_info((e_texture_format)format)->name,
+			(mipmaps ? ", with mipmaps" : ""));
+	free(pixels);
+	return status;
+}